@@ -0,0 +1,190 @@
+#!/usr/bin/env python3
+
+# Searches USE_REG$ assignments in tuning.c (see Makefile, 'autotune' target).
+#
+# Candidates are u8 globals of akatpp output (firmware.tmp.c): coroutine states of threads
+# (they are checked on every iteration of the main loop) and other u8 globals with the most
+# references. Every assignment is built (make firmware.avr) and measured under simavr
+# (bench/firmware-bench): the fewer cycles per superloop the better, code size breaks ties.
+#
+# Search is a hill climb that starts from the current tuning.c: every step tries to add,
+# remove, replace a variable or flip its 'low' flag and keeps the best assignment found so far.
+# The best one is written into tuning.c at the end (even if the search is interrupted).
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+from bench import find_iterations_counter, read_key_values
+
+MAKE = os.environ.get("MAKE", "make")
+SIZE = os.environ.get("SIZE", "avr-size")
+
+TUNING_FILENAME = "tuning.c"
+GENERATED_FILENAME = "firmware.tmp.c"
+ELF_FILENAME = "firmware.avr"
+
+# Must be in harmony with registers akat gives to USE_REG$ (see firmware.cflags):
+# r16 and r17 for variables without 'low' flag and r3..r7 for the rest
+HIGH_REGISTERS = 2
+LOW_REGISTERS = 5
+
+# akat's own register variables
+AKAT_REGISTER_VARS = ("__akat_one__", "akat_every_decisecond_run_required")
+
+USE_REG_RE = re.compile(r"^USE_REG\$\((\w+)(\s*,\s*low)?\);[ \t]*\n", re.MULTILINE)
+REGISTER_VAR_RE = re.compile(r"^register\s+u8\s+(\w+)\s+asm\s*\(", re.MULTILINE)
+U8_GLOBAL_RE = re.compile(r"^static\s+(?:volatile\s+)?u8\s+(\w+)\s*(?:=[^;]*)?;", re.MULTILINE)
+
+COROUTINE_STATE_SUFFIX = "__akat_coroutine_state"
+
+
+# Assignment is a frozenset of (name, low) pairs
+def read_assignment(tuning: str) -> frozenset:
+    return frozenset((m.group(1), bool(m.group(2))) for m in USE_REG_RE.finditer(tuning))
+
+
+def write_assignment(tuning: str, assignment: frozenset) -> str:
+    block = "".join("USE_REG$(" + name + (", low" if low else "") + ");\n"
+                    for name, low in sorted(assignment, key=lambda a: (a[1], a[0])))
+
+    first = USE_REG_RE.search(tuning)
+    without = USE_REG_RE.sub("", tuning)
+    if not first:
+        return tuning + "\n" + block
+
+    return without[:first.start()] + block + without[first.start():]
+
+
+def is_valid(assignment: frozenset) -> bool:
+    low = sum(1 for _, l in assignment if l)
+    return low <= LOW_REGISTERS and len(assignment) - low <= HIGH_REGISTERS
+
+
+def find_candidates(generated: str, count: int) -> list:
+    registers = [n for n in REGISTER_VAR_RE.findall(generated) if n not in AKAT_REGISTER_VARS]
+    globals_ = U8_GLOBAL_RE.findall(generated)
+
+    def references(name: str) -> int:
+        return len(re.findall(r"\b" + re.escape(name) + r"\b", generated))
+
+    states = sorted((n for n in registers + globals_ if n.endswith(COROUTINE_STATE_SUFFIX)), key=references, reverse=True)
+    others = sorted((n for n in registers + globals_ if n not in states), key=references, reverse=True)
+
+    candidates = []
+    for n in states + others:
+        if n not in candidates:
+            candidates.append(n)
+    return candidates[:max(count, len(states))]
+
+
+def neighbours(assignment: frozenset, candidates: list) -> list:
+    names = {n for n, _ in assignment}
+    result = []
+    for name, low in assignment:
+        result.append(assignment - {(name, low)})
+        result.append(assignment - {(name, low)} | {(name, not low)})
+        for c in candidates:
+            if c not in names:
+                result.append(assignment - {(name, low)} | {(c, low)})
+    for c in candidates:
+        if c not in names:
+            result.append(assignment | {(c, False)})
+            result.append(assignment | {(c, True)})
+    return [a for a in result if is_valid(a)]
+
+
+class Evaluator:
+    def __init__(self, tuning: str, bench: str, input_: str, seconds: str):
+        self.tuning = tuning
+        self.bench = bench
+        self.input = input_
+        self.seconds = seconds
+        self.results = {}
+
+    # Returns (cycles per superloop, code size) or None if the assignment doesn't build
+    def evaluate(self, assignment: frozenset):
+        if assignment in self.results:
+            return self.results[assignment]
+
+        with open(TUNING_FILENAME, "w") as f:
+            f.write(write_assignment(self.tuning, assignment))
+
+        result = None
+        build = subprocess.run([MAKE, ELF_FILENAME], capture_output=True, text=True)
+        if build.returncode == 0 and os.path.exists(ELF_FILENAME):
+            raw = ELF_FILENAME + ".autotune"
+            with open(raw, "w") as f:
+                bench = subprocess.run([self.bench, ELF_FILENAME,
+                                        "--seconds", self.seconds,
+                                        "--input", self.input,
+                                        "--iterations-counter", "0x%x" % find_iterations_counter(ELF_FILENAME)], stdout=f)
+            values = read_key_values(raw)
+            os.remove(raw)
+            if bench.returncode == 0 and "cycles_per_superloop" in values:
+                result = (values["cycles_per_superloop"], code_size(ELF_FILENAME))
+
+        self.results[assignment] = result
+        print(describe(assignment), "->", ("%.1f cycles, %d bytes" % result) if result else "failed", flush=True)
+        return result
+
+
+def code_size(elf: str) -> int:
+    out = subprocess.run([SIZE, elf], check=True, capture_output=True, text=True).stdout
+    text, data = out.splitlines()[1].split()[:2]
+    return int(text) + int(data)
+
+
+def describe(assignment: frozenset) -> str:
+    return " ".join(name + ("/low" if low else "") for name, low in sorted(assignment)) or "(none)"
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--bench", default="bench/firmware-bench")
+    parser.add_argument("--input", default="bench/input.txt")
+    parser.add_argument("--seconds", default="10")
+    parser.add_argument("--candidates", type=int, default=16)
+    parser.add_argument("--max-builds", type=int, default=60)
+    args = parser.parse_args()
+
+    with open(TUNING_FILENAME) as f:
+        tuning = f.read()
+
+    # Candidates come from akatpp output of the current tuning.c
+    if subprocess.run([MAKE, GENERATED_FILENAME]).returncode != 0:
+        sys.exit(1)
+    with open(GENERATED_FILENAME) as f:
+        candidates = find_candidates(f.read(), args.candidates)
+    print("Candidates:", " ".join(candidates))
+
+    evaluator = Evaluator(tuning, args.bench, args.input, args.seconds)
+    best = read_assignment(tuning)
+    best_result = None
+
+    try:
+        best_result = evaluator.evaluate(best)
+        if not best_result:
+            print("Current tuning.c doesn't build or run", file=sys.stderr)
+            sys.exit(1)
+
+        improved = True
+        while improved and len(evaluator.results) < args.max_builds:
+            improved = False
+            for a in neighbours(best, candidates):
+                if len(evaluator.results) >= args.max_builds:
+                    break
+                r = evaluator.evaluate(a)
+                if r and r < best_result:
+                    best, best_result = a, r
+                    improved = True
+                    print("Best so far:", describe(best), flush=True)
+                    break
+    finally:
+        with open(TUNING_FILENAME, "w") as f:
+            f.write(write_assignment(tuning, best))
+
+    print("Best:", describe(best), "-> %.1f cycles, %d bytes" % best_result)
+    print("Written", TUNING_FILENAME, "(rebuild firmware.avr before flashing)")
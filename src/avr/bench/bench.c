@@ -0,0 +1,411 @@
+///////////////////////////////////////////////////////////////////
+// Cycle accurate benchmark of firmware.avr under simavr (see bench.py that runs it).
+//
+// Firmware runs on simulated ATmega2560 at 16 MHz with scripted stimuli: bytes sent to USART0
+// (--input, same format as host/sim.c uses), PH sensor voltage on ADC0 (--adc-mv plus noise)
+// and DS18B20 sensors on PA0 (aqua) and PA1 (case).
+//
+// Every executed instruction is attributed to a 'root' address: the address in main()
+// (everything is inlined there) that is executing itself or has called a function that is
+// executing. Cycles spent in ISRs are attributed to ISR vectors instead (per call on average and
+// the most a call has taken, e.g. to check worst cases documented in main.c). bench.py maps
+// root addresses to X_EVERY_DECISECOND$ handlers using debug info (inlined frames).
+//
+// Output (stdout) is 'key value' lines, root addresses go to --profile file as
+// '<hex address> <cycles>' lines.
+///////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sim_avr.h>
+#include <sim_elf.h>
+#include <sim_irq.h>
+#include <sim_interrupts.h>
+#include <sim_cycle_timers.h>
+#include <sim_time.h>
+#include <avr_uart.h>
+#include <avr_adc.h>
+
+#include "ds18b20.h"
+
+#define BENCH_F_CPU           16000000UL
+#define BENCH_FLASH_SIZE      (256UL * 1024UL)
+#define BENCH_VECTORS         57
+#define BENCH_TIMER1_COMPA    17
+
+// ATmega2560 vectors (avr/iom2560.h)
+static const char *const bench_vector_names[BENCH_VECTORS] = {
+    "RESET", "INT0", "INT1", "INT2", "INT3", "INT4", "INT5", "INT6", "INT7", "PCINT0", "PCINT1", "PCINT2",
+    "WDT", "TIMER2_COMPA", "TIMER2_COMPB", "TIMER2_OVF", "TIMER1_CAPT", "TIMER1_COMPA", "TIMER1_COMPB",
+    "TIMER1_COMPC", "TIMER1_OVF", "TIMER0_COMPA", "TIMER0_COMPB", "TIMER0_OVF", "SPI_STC", "USART0_RX",
+    "USART0_UDRE", "USART0_TX", "ANALOG_COMP", "ADC", "EE_READY", "TIMER3_CAPT", "TIMER3_COMPA",
+    "TIMER3_COMPB", "TIMER3_COMPC", "TIMER3_OVF", "USART1_RX", "USART1_UDRE", "USART1_TX", "TWI",
+    "SPM_READY", "TIMER4_CAPT", "TIMER4_COMPA", "TIMER4_COMPB", "TIMER4_COMPC", "TIMER4_OVF",
+    "TIMER5_CAPT", "TIMER5_COMPA", "TIMER5_COMPB", "TIMER5_COMPC", "TIMER5_OVF", "USART2_RX",
+    "USART2_UDRE", "USART2_TX", "USART3_RX", "USART3_UDRE", "USART3_TX"
+};
+
+typedef struct {
+    avr_cycle_count_t pending_cycle;
+    uint8_t pending;
+    uint64_t count;
+    uint64_t cycles;
+    uint64_t max_latency;
+    // Cycles of the call being executed and the most a call has taken (the worst case of the run)
+    uint64_t call_cycles;
+    uint64_t max_call_cycles;
+} BenchVector;
+
+typedef struct {
+    double seconds;
+    char *bytes;
+} BenchInput;
+
+static struct {
+    double seconds;
+    uint32_t adc_mv;
+    uint32_t adc_noise_mv;
+    int16_t aqua_temperatureX16;
+    int16_t case_temperatureX16;
+    const char *input;
+    const char *profile;
+    long iterations_counter;
+} bench_options = {60, 2500, 5, 25 * 16 + 1, 30 * 16 + 8, NULL, NULL, -1};
+
+static avr_t *avr;
+
+static BenchVector bench_vectors[BENCH_VECTORS];
+
+// Shadow call stack: its depth, root address of the outermost call and ISR being executed
+static uint32_t bench_depth;
+static avr_flashaddr_t bench_root;
+static int bench_isr_vector = -1;
+static uint32_t bench_isr_depth;
+static int bench_entered_vector = -1;
+
+// Cycles by root address (in words)
+static uint64_t bench_root_cycles[BENCH_FLASH_SIZE / 2];
+
+static uint64_t bench_uart_bytes;
+static uint64_t bench_iterations;
+static uint64_t bench_iteration_samples;
+
+static BenchInput *bench_inputs;
+static size_t bench_inputs_count;
+static size_t bench_next_input;
+static const char *bench_next_input_byte;
+
+static uint32_t bench_random_state = 2463534242UL;
+
+static uint32_t bench_random(void) {
+    bench_random_state ^= bench_random_state << 13;
+    bench_random_state ^= bench_random_state >> 17;
+    bench_random_state ^= bench_random_state << 5;
+    return bench_random_state;
+}
+
+static uint32_t bench_read_u32(uint16_t address) {
+    const uint8_t *data = avr->data + address;
+    return data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Interrupts
+
+static void bench_on_vector_pending(struct avr_irq_t *irq, uint32_t value, void *param) {
+    BenchVector *v = param;
+    if (value && !v->pending) {
+        v->pending = 1;
+        v->pending_cycle = avr->cycle;
+    } else if (!value) {
+        v->pending = 0;
+    }
+}
+
+static void bench_on_vector_running(struct avr_irq_t *irq, uint32_t value, void *param) {
+    BenchVector *v = param;
+    if (!value) {
+        return;
+    }
+
+    const uint8_t vector = (uint8_t)(v - bench_vectors);
+    const uint64_t latency = avr->cycle - v->pending_cycle;
+    if (latency > v->max_latency) {
+        v->max_latency = latency;
+    }
+    v->pending = 0;
+    v->count += 1;
+    v->call_cycles = 0;
+    bench_entered_vector = vector;
+
+    // Firmware copies the counter of main loop iterations every decisecond (performance_ticker)
+    if (vector == BENCH_TIMER1_COMPA && bench_options.iterations_counter >= 0 && v->count > 1) {
+        bench_iterations += bench_read_u32((uint16_t)bench_options.iterations_counter);
+        bench_iteration_samples += 1;
+    }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Stimuli
+
+static void bench_on_uart_output(struct avr_irq_t *irq, uint32_t value, void *param) {
+    bench_uart_bytes += 1;
+}
+
+// 8 data bits + start bit + stop bit at 9600 baud
+static avr_cycle_count_t bench_send_input_byte(avr_t *avr, avr_cycle_count_t when, void *param) {
+    avr_raise_irq(avr_io_getirq(avr, AVR_IOCTL_UART_GETIRQ('0'), UART_IRQ_INPUT), (uint8_t)*bench_next_input_byte);
+    bench_next_input_byte += 1;
+
+    if (!*bench_next_input_byte) {
+        bench_next_input += 1;
+        if (bench_next_input == bench_inputs_count) {
+            return 0;
+        }
+
+        bench_next_input_byte = bench_inputs[bench_next_input].bytes;
+        const avr_cycle_count_t at = (avr_cycle_count_t)(bench_inputs[bench_next_input].seconds * BENCH_F_CPU);
+        if (at > when) {
+            return at;
+        }
+    }
+
+    return when + BENCH_F_CPU * 10 / 9600;
+}
+
+static void bench_on_adc_trigger(struct avr_irq_t *irq, uint32_t value, void *param) {
+    const uint32_t noise = bench_options.adc_noise_mv ? bench_random() % (2 * bench_options.adc_noise_mv + 1) : 0;
+    avr_raise_irq(avr_io_getirq(avr, AVR_IOCTL_ADC_GETIRQ, ADC_IRQ_ADC0), bench_options.adc_mv + noise - bench_options.adc_noise_mv);
+}
+
+static void bench_load_input(const char *filename) {
+    FILE *f = fopen(filename, "r");
+    if (!f) {
+        perror(filename);
+        exit(2);
+    }
+
+    char *line = NULL;
+    size_t line_size = 0;
+    while (getline(&line, &line_size, f) >= 0) {
+        line[strcspn(line, "\r\n")] = 0;
+
+        char *bytes;
+        const double seconds = strtod(line, &bytes);
+        if (bytes == line || *bytes != ' ' || !bytes[1]) {
+            continue;
+        }
+
+        bench_inputs = realloc(bench_inputs, (bench_inputs_count + 1) * sizeof(BenchInput));
+        bench_inputs[bench_inputs_count].seconds = seconds;
+        bench_inputs[bench_inputs_count].bytes = strdup(bytes + 1);
+        bench_inputs_count += 1;
+    }
+
+    free(line);
+    fclose(f);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Attribution of cycles
+
+static uint16_t bench_opcode(avr_flashaddr_t pc) {
+    return avr->flash[pc] | (avr->flash[pc + 1] << 8);
+}
+
+static uint8_t bench_is_call(uint16_t opcode) {
+    return (opcode & 0xFE0E) == 0x940E   // CALL
+        || (opcode & 0xF000) == 0xD000   // RCALL
+        || opcode == 0x9509              // ICALL
+        || opcode == 0x9519;             // EICALL
+}
+
+static uint8_t bench_is_return(uint16_t opcode) {
+    return opcode == 0x9508 || opcode == 0x9518;  // RET, RETI
+}
+
+static void bench_step(void) {
+    const avr_flashaddr_t pc = avr->pc;
+    const uint16_t opcode = bench_opcode(pc);
+    const avr_cycle_count_t cycle = avr->cycle;
+
+    bench_entered_vector = -1;
+    avr_run(avr);
+
+    const uint64_t cycles = avr->cycle - cycle;
+    if (bench_isr_vector >= 0) {
+        bench_vectors[bench_isr_vector].cycles += cycles;
+        bench_vectors[bench_isr_vector].call_cycles += cycles;
+    } else {
+        bench_root_cycles[(bench_depth ? bench_root : pc) / 2] += cycles;
+    }
+
+    if (bench_is_return(opcode)) {
+        if (bench_depth) {
+            bench_depth -= 1;
+        }
+        if (bench_isr_vector >= 0 && bench_depth == bench_isr_depth) {
+            BenchVector *v = &bench_vectors[bench_isr_vector];
+            if (v->call_cycles > v->max_call_cycles) {
+                v->max_call_cycles = v->call_cycles;
+            }
+            bench_isr_vector = -1;
+        }
+    } else if (bench_is_call(opcode)) {
+        if (!bench_depth) {
+            bench_root = pc;
+        }
+        bench_depth += 1;
+    }
+
+    // Interrupt is serviced after the instruction (ISRs don't nest, I flag is cleared)
+    if (bench_entered_vector >= 0) {
+        bench_isr_vector = bench_entered_vector;
+        bench_isr_depth = bench_depth;
+        bench_depth += 1;
+    }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void bench_usage(const char *name) {
+    fprintf(stderr,
+            "Usage: %s firmware.avr [--seconds N] [--adc-mv N] [--adc-noise-mv N] [--input FILE]\n"
+            "          [--profile FILE] [--iterations-counter ADDRESS]\n"
+            "  --seconds             Simulated time (default %.0f)\n"
+            "  --adc-mv              Voltage of PH sensor on ADC0 (default %u)\n"
+            "  --adc-noise-mv        Max noise added to the voltage (default %u)\n"
+            "  --input               Script of bytes sent to USART0: '<seconds> <bytes>' per line\n"
+            "  --profile             File to write cycles by root address to\n"
+            "  --iterations-counter  SRAM address of main_loop_iterations_in_last_decisecond\n",
+            name, bench_options.seconds, bench_options.adc_mv, bench_options.adc_noise_mv);
+    exit(2);
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        bench_usage(argv[0]);
+    }
+    const char *firmware = argv[1];
+
+    for (int i = 2; i < argc; i += 2) {
+        const char *arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+
+        if (!value) {
+            bench_usage(argv[0]);
+        }
+
+        if (!strcmp(arg, "--seconds")) {
+            bench_options.seconds = atof(value);
+        } else if (!strcmp(arg, "--adc-mv")) {
+            bench_options.adc_mv = (uint32_t)atol(value);
+        } else if (!strcmp(arg, "--adc-noise-mv")) {
+            bench_options.adc_noise_mv = (uint32_t)atol(value);
+        } else if (!strcmp(arg, "--input")) {
+            bench_options.input = value;
+        } else if (!strcmp(arg, "--profile")) {
+            bench_options.profile = value;
+        } else if (!strcmp(arg, "--iterations-counter")) {
+            bench_options.iterations_counter = strtol(value, NULL, 0);
+        } else {
+            bench_usage(argv[0]);
+        }
+    }
+
+    elf_firmware_t f;
+    memset(&f, 0, sizeof(f));
+    if (elf_read_firmware(firmware, &f)) {
+        fprintf(stderr, "bench: Can't read %s\n", firmware);
+        return 2;
+    }
+
+    avr = avr_make_mcu_by_name("atmega2560");
+    if (!avr) {
+        fprintf(stderr, "bench: simavr doesn't support atmega2560\n");
+        return 2;
+    }
+
+    avr_init(avr);
+    avr->frequency = BENCH_F_CPU;
+    avr->vcc = avr->avcc = avr->aref = 5000;
+    avr_load_firmware(avr, &f);
+
+    // Bytes are counted here, simavr must not print them
+    uint32_t uart_flags = 0;
+    avr_ioctl(avr, AVR_IOCTL_UART_GET_FLAGS('0'), &uart_flags);
+    uart_flags &= ~AVR_UART_FLAG_STDIO;
+    avr_ioctl(avr, AVR_IOCTL_UART_SET_FLAGS('0'), &uart_flags);
+    avr_irq_register_notify(avr_io_getirq(avr, AVR_IOCTL_UART_GETIRQ('0'), UART_IRQ_OUTPUT), bench_on_uart_output, NULL);
+
+    avr_irq_register_notify(avr_io_getirq(avr, AVR_IOCTL_ADC_GETIRQ, ADC_IRQ_OUT_TRIGGER), bench_on_adc_trigger, NULL);
+    bench_on_adc_trigger(NULL, 0, NULL);
+
+    ds18b20_t *aqua = ds18b20_attach(avr, 'A', 0, bench_options.aqua_temperatureX16);
+    ds18b20_t *case_ = ds18b20_attach(avr, 'A', 1, bench_options.case_temperatureX16);
+
+    for (uint8_t v = 1; v < BENCH_VECTORS; v++) {
+        avr_irq_t *irq = avr_get_interrupt_irq(avr, v);
+        if (irq) {
+            avr_irq_register_notify(irq + AVR_INT_IRQ_PENDING, bench_on_vector_pending, &bench_vectors[v]);
+            avr_irq_register_notify(irq + AVR_INT_IRQ_RUNNING, bench_on_vector_running, &bench_vectors[v]);
+        }
+    }
+
+    if (bench_options.input) {
+        bench_load_input(bench_options.input);
+        if (bench_inputs_count) {
+            bench_next_input_byte = bench_inputs[0].bytes;
+            avr_cycle_timer_register(avr, (avr_cycle_count_t)(bench_inputs[0].seconds * BENCH_F_CPU) + 1, bench_send_input_byte, NULL);
+        }
+    }
+
+    const avr_cycle_count_t end_cycle = (avr_cycle_count_t)(bench_options.seconds * BENCH_F_CPU);
+    while (avr->cycle < end_cycle) {
+        bench_step();
+
+        if (avr->state == cpu_Done || avr->state == cpu_Crashed) {
+            fprintf(stderr, "bench: Firmware stopped at 0x%06x after %.3f seconds\n", avr->pc, (double)avr->cycle / BENCH_F_CPU);
+            return 3;
+        }
+    }
+
+    const double seconds = (double)avr->cycle / BENCH_F_CPU;
+
+    printf("seconds %.1f\n", seconds);
+    if (bench_iterations) {
+        printf("cycles_per_superloop %.1f\n", (double)bench_iteration_samples * BENCH_F_CPU / 10 / bench_iterations);
+    }
+    printf("usart0_tx_bytes_per_second %.1f\n", bench_uart_bytes / seconds);
+    printf("ds18b20_conversions_per_minute %.1f\n", (ds18b20_get_conversions(aqua) + ds18b20_get_conversions(case_)) * 60 / seconds);
+
+    for (uint8_t v = 1; v < BENCH_VECTORS; v++) {
+        const BenchVector *vector = &bench_vectors[v];
+        if (vector->count) {
+            printf("isr_max_latency_cycles.%s %llu\n", bench_vector_names[v], (unsigned long long)vector->max_latency);
+            printf("isr_cycles_per_call.%s %.1f\n", bench_vector_names[v], (double)vector->cycles / vector->count);
+            printf("isr_max_cycles_per_call.%s %llu\n", bench_vector_names[v], (unsigned long long)vector->max_call_cycles);
+            printf("isr_calls_per_second.%s %.1f\n", bench_vector_names[v], vector->count / seconds);
+        }
+    }
+
+    if (bench_options.profile) {
+        FILE *profile = fopen(bench_options.profile, "w");
+        if (!profile) {
+            perror(bench_options.profile);
+            return 2;
+        }
+
+        for (size_t i = 0; i < BENCH_FLASH_SIZE / 2; i++) {
+            if (bench_root_cycles[i]) {
+                fprintf(profile, "%06zx %llu\n", i * 2, (unsigned long long)bench_root_cycles[i]);
+            }
+        }
+
+        fclose(profile);
+    }
+
+    return 0;
+}
@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+
+# Runs firmware.avr under simavr (bench.c, see Makefile, 'bench' target), attributes cycles spent
+# in main() to X_EVERY_DECISECOND$ handlers and compares results with the baseline.
+#
+# Handlers are inlined into main(), so they are found by inlined frames of debug info
+# (addr2line -i): cycles of an address belong to the handler whose frame is right under
+# akat_on_every_decisecond. Everything else in main() is the rest of the superloop.
+#
+# Results are 'key value' lines, so baseline can be committed and diffed.
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+NM = os.environ.get("NM", "avr-nm")
+ADDR2LINE = os.environ.get("ADDR2LINE", "avr-addr2line")
+
+DECISECOND_RUNNER = "akat_on_every_decisecond"
+
+# Copied every decisecond by performance_ticker (main.c)
+ITERATIONS_COUNTER_RE = re.compile(r"^main_loop_iterations_in_last_decisecond(\.\w+)*$")
+
+# SRAM symbols are at 0x800000 in AVR ELF files
+SRAM_OFFSET = 0x800000
+
+# Keys where larger value is better
+LARGER_IS_BETTER = ("usart0_tx_bytes_per_second", "ds18b20_conversions_per_minute")
+
+
+def find_iterations_counter(elf: str) -> int:
+    out = subprocess.run([NM, elf], check=True, capture_output=True, text=True).stdout
+    for line in out.splitlines():
+        parts = line.split()
+        if len(parts) == 3 and ITERATIONS_COUNTER_RE.match(parts[2]):
+            return int(parts[0], 16) - SRAM_OFFSET
+    raise ValueError("main_loop_iterations_in_last_decisecond is not found in " + elf)
+
+
+def read_key_values(filename: str) -> dict:
+    values = {}
+    with open(filename) as f:
+        for line in f:
+            parts = line.split()
+            if len(parts) == 2:
+                values[parts[0]] = float(parts[1])
+    return values
+
+
+def write_key_values(filename: str, values: dict):
+    with open(filename, "w") as f:
+        for k in sorted(values):
+            f.write(k + " " + ("%.1f" % values[k]) + "\n")
+
+
+# Returns inlined frames (innermost first) of every address
+def resolve_frames(elf: str, addresses: list) -> dict:
+    stdin = "".join("0x%x\n" % a for a in addresses)
+    out = subprocess.run([ADDR2LINE, "-a", "-f", "-i", "-e", elf], input=stdin, check=True, capture_output=True, text=True).stdout
+
+    frames = {}
+    address = None
+    lines = out.splitlines()
+    i = 0
+    while i < len(lines):
+        if lines[i].startswith("0x"):
+            address = int(lines[i], 16)
+            frames[address] = []
+            i += 1
+        else:
+            frames[address].append(lines[i])
+            i += 2
+    return frames
+
+
+def handler_of(frames: list) -> str:
+    if DECISECOND_RUNNER in frames:
+        k = frames.index(DECISECOND_RUNNER)
+        return frames[k - 1] if k > 0 else DECISECOND_RUNNER
+    return None
+
+
+def attribute_profile(elf: str, profile: str, deciseconds: float) -> dict:
+    cycles = {}
+    with open(profile) as f:
+        for line in f:
+            address, c = line.split()
+            cycles[int(address, 16)] = int(c)
+
+    values = {}
+    total = 0
+    for address, frames in resolve_frames(elf, sorted(cycles)).items():
+        handler = handler_of(frames)
+        if handler:
+            key = "decisecond_cycles." + handler
+            values[key] = values.get(key, 0) + cycles[address] / deciseconds
+            total += cycles[address] / deciseconds
+    values["decisecond_cycles_total"] = total
+    return values
+
+
+def print_comparison(results: dict, baseline: dict):
+    width = max(len(k) for k in results)
+    for k in sorted(results):
+        v = results[k]
+        if k not in baseline:
+            print(k.ljust(width), "%12.1f" % v, "   (new)")
+            continue
+
+        b = baseline[k]
+        delta = "%+.1f%%" % ((v - b) / b * 100) if b else ("%+.1f" % (v - b))
+        worse = (v < b) if k in LARGER_IS_BETTER else (v > b)
+        mark = " <<" if worse and abs(v - b) > max(abs(b) * 0.01, 0.5) else ""
+        print(k.ljust(width), "%12.1f" % v, "%12.1f" % b, delta.rjust(9) + mark)
+
+    for k in sorted(set(baseline) - set(results)):
+        print(k.ljust(width), "%12s" % "-", "%12.1f" % baseline[k], "   (gone)")
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument("elf")
+    parser.add_argument("--bench", default="bench/firmware-bench")
+    parser.add_argument("--input", default="bench/input.txt")
+    parser.add_argument("--seconds", default="60")
+    parser.add_argument("--results", default="bench/results.txt")
+    parser.add_argument("--baseline", default="bench/baseline.txt")
+    args = parser.parse_args()
+
+    profile = args.results + ".profile"
+    raw = args.results + ".raw"
+
+    with open(raw, "w") as f:
+        subprocess.run([args.bench, args.elf,
+                        "--seconds", args.seconds,
+                        "--input", args.input,
+                        "--profile", profile,
+                        "--iterations-counter", "0x%x" % find_iterations_counter(args.elf)], check=True, stdout=f)
+
+    results = read_key_values(raw)
+    deciseconds = results["isr_calls_per_second.TIMER1_COMPA"] * results["seconds"]
+    results.update(attribute_profile(args.elf, profile, deciseconds))
+    results["isr_max_latency_cycles"] = max(v for k, v in results.items() if k.startswith("isr_max_latency_cycles."))
+    del results["seconds"]
+
+    write_key_values(args.results, results)
+
+    if os.path.exists(args.baseline):
+        print_comparison(results, read_key_values(args.baseline))
+    else:
+        print_comparison(results, {})
+        print("No baseline yet (" + args.baseline + "), 'make bench-baseline' saves these results as baseline", file=sys.stderr)
@@ -0,0 +1,263 @@
+///////////////////////////////////////////////////////////////////
+// DS18B20 on a simavr GPIO pin, see ds18b20.h
+//
+// Line is low when master drives it low (DDR bit is 1 and PORT bit is 0) or when the sensor
+// pulls it low. Sensor reacts on edges of master's low pulses:
+//  - pulse longer than 400us is a reset, sensor answers with a presence pulse
+//  - otherwise it's a time slot: master writes 1 with a pulse shorter than 15us, or reads
+//    a bit that sensor sends by holding line low for 30us after the falling edge (for 0)
+///////////////////////////////////////////////////////////////////
+
+#include <stdlib.h>
+
+#include <sim_avr.h>
+#include <sim_irq.h>
+#include <sim_cycle_timers.h>
+#include <sim_time.h>
+#include <avr_ioport.h>
+
+#include "ds18b20.h"
+
+#define DS18B20_RESET_MIN_US          400
+#define DS18B20_PRESENCE_DELAY_US     30
+#define DS18B20_PRESENCE_US           120
+#define DS18B20_WRITE_ONE_MAX_US      15
+#define DS18B20_READ_ZERO_US          30
+
+typedef enum {
+    Ds18b20Idle,
+    Ds18b20RomCommand,
+    Ds18b20MatchRom,
+    Ds18b20FunctionCommand,
+    Ds18b20WriteScratchpad,
+    Ds18b20Sending,
+    Ds18b20SendingOnes
+} Ds18b20State;
+
+struct ds18b20_t {
+    avr_t *avr;
+    avr_irq_t *pin_irq;
+    uint8_t mask;
+
+    uint8_t ddr;
+    uint8_t port;
+    uint8_t master_low;
+    avr_cycle_count_t fall_cycle;
+
+    Ds18b20State state;
+    uint8_t byte;
+    uint8_t bits;
+    uint8_t bytes;
+
+    const uint8_t *send;
+    uint8_t send_size;
+
+    uint8_t rom[8];
+    uint8_t scratchpad[9];
+    uint32_t conversions;
+};
+
+// Dallas/Maxim CRC8 (x^8 + x^5 + x^4 + 1, reflected)
+static uint8_t ds18b20_crc8(const uint8_t *data, uint8_t size) {
+    uint8_t crc = 0;
+    for (uint8_t i = 0; i < size; i++) {
+        crc ^= data[i];
+        for (uint8_t b = 0; b < 8; b++) {
+            crc = (crc & 1) ? (crc >> 1) ^ 0x8C : crc >> 1;
+        }
+    }
+    return crc;
+}
+
+static avr_cycle_count_t ds18b20_us(const ds18b20_t *sensor, uint32_t us) {
+    return avr_usec_to_cycles(sensor->avr, us);
+}
+
+static avr_cycle_count_t ds18b20_release(avr_t *avr, avr_cycle_count_t when, void *param) {
+    ds18b20_t *sensor = param;
+    avr_raise_irq(sensor->pin_irq, 1);
+    return 0;
+}
+
+static avr_cycle_count_t ds18b20_presence(avr_t *avr, avr_cycle_count_t when, void *param) {
+    ds18b20_t *sensor = param;
+    avr_raise_irq(sensor->pin_irq, 0);
+    avr_cycle_timer_register(avr, ds18b20_us(sensor, DS18B20_PRESENCE_US), ds18b20_release, sensor);
+    return 0;
+}
+
+static void ds18b20_start_sending(ds18b20_t *sensor, const uint8_t *data, uint8_t size) {
+    sensor->state = Ds18b20Sending;
+    sensor->send = data;
+    sensor->send_size = size;
+    sensor->bytes = 0;
+}
+
+static void ds18b20_on_byte(ds18b20_t *sensor, uint8_t byte) {
+    switch (sensor->state) {
+    case Ds18b20RomCommand:
+        if (byte == 0xCC) {
+            sensor->state = Ds18b20FunctionCommand;
+        } else if (byte == 0x33) {
+            ds18b20_start_sending(sensor, sensor->rom, sizeof(sensor->rom));
+        } else if (byte == 0x55) {
+            sensor->state = Ds18b20MatchRom;
+            sensor->bytes = 0;
+        } else {
+            sensor->state = Ds18b20Idle;
+        }
+        break;
+
+    case Ds18b20MatchRom:
+        if (byte != sensor->rom[sensor->bytes]) {
+            sensor->state = Ds18b20Idle;
+        } else if (++sensor->bytes == sizeof(sensor->rom)) {
+            sensor->state = Ds18b20FunctionCommand;
+        }
+        break;
+
+    case Ds18b20FunctionCommand:
+        if (byte == 0x44) {
+            sensor->conversions += 1;
+            sensor->state = Ds18b20SendingOnes;
+        } else if (byte == 0xBE) {
+            ds18b20_start_sending(sensor, sensor->scratchpad, sizeof(sensor->scratchpad));
+        } else if (byte == 0x4E) {
+            sensor->state = Ds18b20WriteScratchpad;
+            sensor->bytes = 0;
+        } else if (byte == 0xB4) {
+            // Not parasite powered
+            sensor->state = Ds18b20SendingOnes;
+        } else {
+            sensor->state = Ds18b20Idle;
+        }
+        break;
+
+    case Ds18b20WriteScratchpad:
+        // TH, TL and configuration
+        sensor->scratchpad[2 + sensor->bytes] = byte;
+        if (++sensor->bytes == 3) {
+            sensor->scratchpad[8] = ds18b20_crc8(sensor->scratchpad, 8);
+            sensor->state = Ds18b20Idle;
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+static uint8_t ds18b20_bit_to_send(const ds18b20_t *sensor) {
+    if (sensor->state == Ds18b20SendingOnes) {
+        return 1;
+    }
+    if (sensor->state == Ds18b20Sending && sensor->bytes < sensor->send_size) {
+        return (sensor->send[sensor->bytes] >> sensor->bits) & 1;
+    }
+    return 1;
+}
+
+static void ds18b20_on_master_fall(ds18b20_t *sensor) {
+    sensor->fall_cycle = sensor->avr->cycle;
+
+    if (!ds18b20_bit_to_send(sensor)) {
+        avr_raise_irq(sensor->pin_irq, 0);
+        avr_cycle_timer_register(sensor->avr, ds18b20_us(sensor, DS18B20_READ_ZERO_US), ds18b20_release, sensor);
+    }
+}
+
+static void ds18b20_on_master_rise(ds18b20_t *sensor) {
+    const uint64_t us = avr_cycles_to_usec(sensor->avr, sensor->avr->cycle - sensor->fall_cycle);
+
+    if (us >= DS18B20_RESET_MIN_US) {
+        sensor->state = Ds18b20RomCommand;
+        sensor->bits = 0;
+        sensor->byte = 0;
+        avr_cycle_timer_cancel(sensor->avr, ds18b20_release, sensor);
+        avr_raise_irq(sensor->pin_irq, 1);
+        avr_cycle_timer_register(sensor->avr, ds18b20_us(sensor, DS18B20_PRESENCE_DELAY_US), ds18b20_presence, sensor);
+        return;
+    }
+
+    switch (sensor->state) {
+    case Ds18b20Idle:
+    case Ds18b20SendingOnes:
+        break;
+
+    case Ds18b20Sending:
+        if (++sensor->bits == 8) {
+            sensor->bits = 0;
+            if (++sensor->bytes == sensor->send_size) {
+                sensor->state = Ds18b20Idle;
+            }
+        }
+        break;
+
+    default:
+        sensor->byte = (uint8_t)((sensor->byte >> 1) | (us < DS18B20_WRITE_ONE_MAX_US ? 0x80 : 0));
+        if (++sensor->bits == 8) {
+            sensor->bits = 0;
+            ds18b20_on_byte(sensor, sensor->byte);
+        }
+        break;
+    }
+}
+
+static void ds18b20_update(ds18b20_t *sensor) {
+    const uint8_t master_low = (sensor->ddr & sensor->mask) && !(sensor->port & sensor->mask);
+    if (master_low == sensor->master_low) {
+        return;
+    }
+
+    sensor->master_low = master_low;
+    if (master_low) {
+        ds18b20_on_master_fall(sensor);
+    } else {
+        ds18b20_on_master_rise(sensor);
+    }
+}
+
+static void ds18b20_on_ddr(struct avr_irq_t *irq, uint32_t value, void *param) {
+    ds18b20_t *sensor = param;
+    sensor->ddr = (uint8_t)value;
+    ds18b20_update(sensor);
+}
+
+static void ds18b20_on_port(struct avr_irq_t *irq, uint32_t value, void *param) {
+    ds18b20_t *sensor = param;
+    sensor->port = (uint8_t)value;
+    ds18b20_update(sensor);
+}
+
+ds18b20_t *ds18b20_attach(avr_t *avr, char port, uint8_t pin, int16_t temperatureX16) {
+    ds18b20_t *sensor = calloc(1, sizeof(ds18b20_t));
+    sensor->avr = avr;
+    sensor->mask = (uint8_t)(1 << pin);
+    sensor->pin_irq = avr_io_getirq(avr, AVR_IOCTL_IOPORT_GETIRQ(port), pin);
+
+    // Family code 0x28, serial number is made of port and pin
+    const uint8_t rom[7] = {0x28, (uint8_t)port, pin, 0, 0, 0, 0};
+    for (uint8_t i = 0; i < 7; i++) {
+        sensor->rom[i] = rom[i];
+    }
+    sensor->rom[7] = ds18b20_crc8(sensor->rom, 7);
+
+    // Power-up state of the scratchpad (12 bit resolution)
+    const uint8_t scratchpad[8] = {(uint8_t)temperatureX16, (uint8_t)(temperatureX16 >> 8), 0x4B, 0x46, 0x7F, 0xFF, 0x0C, 0x10};
+    for (uint8_t i = 0; i < 8; i++) {
+        sensor->scratchpad[i] = scratchpad[i];
+    }
+    sensor->scratchpad[8] = ds18b20_crc8(sensor->scratchpad, 8);
+
+    avr_irq_register_notify(avr_io_getirq(avr, AVR_IOCTL_IOPORT_GETIRQ(port), IOPORT_IRQ_DIRECTION_ALL), ds18b20_on_ddr, sensor);
+    avr_irq_register_notify(avr_io_getirq(avr, AVR_IOCTL_IOPORT_GETIRQ(port), IOPORT_IRQ_REG_PORT), ds18b20_on_port, sensor);
+
+    // Pull-up resistor
+    avr_raise_irq(sensor->pin_irq, 1);
+
+    return sensor;
+}
+
+uint32_t ds18b20_get_conversions(const ds18b20_t *sensor) {
+    return sensor->conversions;
+}
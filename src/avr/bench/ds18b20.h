@@ -0,0 +1,22 @@
+///////////////////////////////////////////////////////////////////
+// DS18B20 on a simavr GPIO pin (bus with one sensor and a pull-up resistor).
+//
+// Supports reset/presence, Skip ROM, Read ROM, Match ROM, Convert T, Read/Write Scratchpad.
+// Conversion completes immediately (read slots return 1 right away).
+///////////////////////////////////////////////////////////////////
+
+#ifndef BENCH_DS18B20_H
+#define BENCH_DS18B20_H
+
+#include <stdint.h>
+
+#include <sim_avr.h>
+
+typedef struct ds18b20_t ds18b20_t;
+
+// temperatureX16 is in 1/16 of Celsius (as in scratchpad)
+ds18b20_t *ds18b20_attach(avr_t *avr, char port, uint8_t pin, int16_t temperatureX16);
+
+uint32_t ds18b20_get_conversions(const ds18b20_t *sensor);
+
+#endif
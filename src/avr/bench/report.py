@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+
+# Code size and cycles report of a build, compared with the saved baseline (see Makefile, 'report' target).
+#
+# Report is 'key value' lines (like bench results, so baseline can be committed and diffed):
+#   size.text / size.data / size.bss     totals of firmware.avr
+#   flash.<symbol> / ram.<symbol>        size of every symbol (nm --print-size)
+#   inlined.<function>                   number of copies inlined by IPA inliner (-fdump-ipa-inline)
+#   inline_growth.<function>             sum of size changes caused by those copies
+#   everything from bench results        cycles per superloop, ISRs, X_EVERY_DECISECOND$ handlers
+#
+# Values that grow by more than --threshold percent (and by more than a few units, so tiny symbols
+# don't make noise) are regressions, report exits with code 1 if there are any.
+
+import argparse
+import glob
+import os
+import re
+import subprocess
+import sys
+
+from bench import LARGER_IS_BETTER, read_key_values, write_key_values
+
+NM = os.environ.get("NM", "avr-nm")
+SIZE = os.environ.get("SIZE", "avr-size")
+
+# Inlined foo/12 into bar/34 which now has time 15.00 and size 20, net change of +3.
+INLINED_RE = re.compile(r"^\s*Inlined\s+(?:\S+\s+)??([\w.]+)/\d+\s+into\s+([\w.]+)/\d+(?:.*net change of ([+-]\d+))?")
+
+# Absolute growth that is never a regression: bytes for sizes, cycles for cycles, etc
+MIN_REGRESSION = 4
+
+
+def read_sizes(elf: str) -> dict:
+    values = {}
+
+    out = subprocess.run([SIZE, elf], check=True, capture_output=True, text=True).stdout
+    text, data, bss = out.splitlines()[1].split()[:3]
+    values["size.text"] = int(text)
+    values["size.data"] = int(data)
+    values["size.bss"] = int(bss)
+
+    out = subprocess.run([NM, "--print-size", "--size-sort", "--radix=d", elf], check=True, capture_output=True, text=True).stdout
+    for line in out.splitlines():
+        parts = line.split()
+        if len(parts) != 4:
+            continue
+        _, size, kind, name = parts
+        prefix = "flash." if kind in "tTwW" else "ram."
+        values[prefix + name] = values.get(prefix + name, 0) + int(size)
+
+    return values
+
+
+def read_inlining(dumps: list) -> dict:
+    values = {}
+    for filename in dumps:
+        with open(filename) as f:
+            for line in f:
+                m = INLINED_RE.match(line)
+                if not m:
+                    continue
+                callee = m.group(1)
+                values["inlined." + callee] = values.get("inlined." + callee, 0) + 1
+                if m.group(3):
+                    values["inline_growth." + callee] = values.get("inline_growth." + callee, 0) + int(m.group(3))
+    return values
+
+
+def find_regressions(report: dict, baseline: dict, threshold: float) -> list:
+    regressions = []
+    for k in sorted(report):
+        v = report[k]
+        b = baseline.get(k)
+        if b is None:
+            if v > MIN_REGRESSION and k.startswith(("flash.", "ram.", "inline_growth.")):
+                regressions.append((k, v, None))
+            continue
+
+        growth = (b - v) if k.endswith(LARGER_IS_BETTER) else (v - b)
+        if growth > MIN_REGRESSION and growth > abs(b) * threshold / 100:
+            regressions.append((k, v, b))
+    return regressions
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument("elf")
+    parser.add_argument("--results", default="bench/results.txt")
+    parser.add_argument("--report", default="bench/report.txt")
+    parser.add_argument("--baseline", default="bench/report-baseline.txt")
+    parser.add_argument("--threshold", type=float, default=2)
+    args = parser.parse_args()
+
+    report = read_sizes(args.elf)
+    report.update(read_inlining(glob.glob("*.inline")))
+    if os.path.exists(args.results):
+        report.update(read_key_values(args.results))
+
+    write_key_values(args.report, report)
+    print("Written", args.report, "(" + str(len(report)) + " values)")
+
+    if not os.path.exists(args.baseline):
+        print("No baseline yet (" + args.baseline + "), 'make report-baseline' saves this report as baseline", file=sys.stderr)
+        sys.exit(0)
+
+    baseline = read_key_values(args.baseline)
+    for k in ("size.text", "size.data", "size.bss", "cycles_per_superloop", "decisecond_cycles_total", "isr_max_latency_cycles"):
+        if k in report and k in baseline:
+            print(k.ljust(26), "%10.1f" % report[k], "%10.1f" % baseline[k], "%+10.1f" % (report[k] - baseline[k]))
+
+    regressions = find_regressions(report, baseline, args.threshold)
+    if not regressions:
+        print("No regressions above", str(args.threshold) + "%")
+        sys.exit(0)
+
+    print("Regressions above", str(args.threshold) + "%:")
+    width = max(len(k) for k, _, _ in regressions)
+    for k, v, b in regressions:
+        print("  " + k.ljust(width), "%10.1f" % v, ("%10.1f" % b) if b is not None else "       new")
+    sys.exit(1)
@@ -0,0 +1,366 @@
+// This file is auto-generated by src/co2nn/export_avr.py from data/co2-model.h5! DON'T EDIT!
+// Max error of quantized prediction on random inputs: 0.0430 PH
+
+#define CO2NN_WINDOW_LENGTH  60
+#define CO2NN_FEATURES  5
+#define CO2NN_ACTIVATION_BITS  12
+#define CO2NN_SELU_SCALE_Q12  4304
+#define CO2NN_SELU_TABLE_SIZE  65
+#define CO2NN_SELU_TABLE_STEP_BITS  9
+
+static const i16 co2nn_selu_table[65] PROGMEM = {
+    0, -846, -1593, -2252, -2833, -3347, -3800, -4199, -4552, -4863, -5138, -5380, -5594,
+    -5783, -5950, -6097, -6227, -6341, -6442, -6531, -6610, -6680, -6741, -6795, -6843, -6885,
+    -6922, -6955, -6984, -7009, -7032, -7052, -7069, -7085, -7098, -7111, -7121, -7131, -7139,
+    -7146, -7153, -7158, -7163, -7168, -7172, -7175, -7178, -7181, -7183, -7185, -7187, -7189,
+    -7190, -7192, -7193, -7194, -7195, -7195, -7196, -7197, -7197, -7198, -7198, -7198, -7199,
+};
+
+// L0aConv: 1 step(s) of 5 channel(s) -> 6
+#define CO2NN_L0ACONV_INPUTS  5
+#define CO2NN_L0ACONV_OUTPUTS  6
+static const i16 co2nn_l0aconv_weights[30] PROGMEM = {
+    -285, 23931, -599, 495, 4409, 0, -3184, 4043,
+    -2302, 4079, -144, 16696, 158, -392, 250, -10769,
+    -23106, 72, -497, 5122, 174, 17032, 7034, -2453,
+    3719, -26043, 2962, -14597, 17411, 433,
+};
+static const i32 co2nn_l0aconv_bias[6] PROGMEM = {
+    -43127088, -504400, -21554120, 67283232, -25046256, 722393,
+};
+static const u8 co2nn_l0aconv_shifts[6] PROGMEM = {
+    16, 16, 14, 16, 16, 16,
+};
+
+// L0bConv: 1 step(s) of 6 channel(s) -> 6
+#define CO2NN_L0BCONV_INPUTS  6
+#define CO2NN_L0BCONV_OUTPUTS  6
+static const i8 co2nn_l0bconv_weights[36] PROGMEM = {
+    40, -11, 111, -51, 20, 17, 63, 35, 113, 0, 67, -77, 0, 4, 1, -4,
+    14, -124, 20, -2, 66, -30, 23, -16, 32, 1, 84, 2, 13, 114, 20, 1,
+    65, 0, 31, -73,
+};
+static const i32 co2nn_l0bconv_bias[6] PROGMEM = {
+    -97764, -41758, -214025, -47047, 193566, -62212,
+};
+static const u8 co2nn_l0bconv_shifts[6] PROGMEM = {
+    7, 9, 8, 7, 9, 9,
+};
+
+// L0cConv: 1 step(s) of 6 channel(s) -> 2
+#define CO2NN_L0CCONV_INPUTS  6
+#define CO2NN_L0CCONV_OUTPUTS  2
+static const i8 co2nn_l0cconv_weights[12] PROGMEM = {
+    69, 17, 1, 37, 16, 8, -4, 29, 70, 33, -21, 22,
+};
+static const i32 co2nn_l0cconv_bias[2] PROGMEM = {
+    -13376, -29725,
+};
+static const u8 co2nn_l0cconv_shifts[2] PROGMEM = {
+    6, 7,
+};
+
+// L1Conv: 4 step(s) of 2 channel(s) -> 15
+#define CO2NN_L1CONV_INPUTS  8
+#define CO2NN_L1CONV_OUTPUTS  15
+static const i8 co2nn_l1conv_weights[120] PROGMEM = {
+    36, 4, 50, 5, 19, -5, -77, -13, -50, 13, -66, 21, -61, 10, -24, -24,
+    -16, -14, -12, -28, -5, -85, -16, -71, -47, 55, -80, -42, -33, -110, -86, 107,
+    -2, 12, 6, -87, 3, 38, 11, 6, 32, -1, 42, 22, 36, -2, 71, 40,
+    100, 0, 53, 0, -71, 0, -61, 0, 13, -17, 11, -62, -8, -96, 30, 17,
+    -35, -57, -2, -3, -28, -2, -76, -32, 9, -4, 35, 1, 34, 19, -72, 15,
+    -19, 37, -44, -11, -57, 63, -50, 127, 3, -108, 37, -37, 65, -41, 16, -25,
+    -60, 18, -77, 26, -89, 13, -119, -30, 13, 123, -57, 107, -34, 66, 90, -17,
+    -123, 29, -95, 22, -85, 52, -52, 68,
+};
+static const i32 co2nn_l1conv_bias[15] PROGMEM = {
+    -19142, -51973, 57022, 230637, -71602, 30754, 108492, -263555,
+    -166892, 824, 197454, -215611, 61621, 524760, 534558,
+};
+static const u8 co2nn_l1conv_shifts[15] PROGMEM = {
+    7, 8, 9, 11, 9, 8, 11, 9, 8, 7, 9, 9, 10, 10, 11,
+};
+
+// L2Conv: 3 step(s) of 15 channel(s) -> 30
+#define CO2NN_L2CONV_INPUTS  45
+#define CO2NN_L2CONV_OUTPUTS  30
+static const i8 co2nn_l2conv_weights[1350] PROGMEM = {
+    -29, 23, -23, 0, 8, -21, 0, 0, 12, -4, 10, -15, -6, 0, 1, -55,
+    14, -15, 0, 18, -26, 0, -11, -8, -7, -28, -12, -4, 0, -2, -93, -30,
+    12, 0, 1, 49, 0, 12, -57, -82, -19, 12, -15, 0, -10, 49, -15, 17,
+    -2, -12, 11, 0, 0, -4, 23, -10, 15, -1, 4, -6, 39, 13, 13, 1,
+    -19, 7, 0, 3, 20, 4, 0, 3, 0, -1, 0, 42, -6, -9, 1, 1,
+    3, 0, 1, 12, 77, 1, -1, -1, -9, 3, -46, 68, 10, 6, 0, -25,
+    -5, -4, 35, -5, 19, 0, 14, 0, 12, -47, 24, 8, -1, 0, -6, 0,
+    5, 10, -35, 2, -1, 2, 0, 5, -12, 25, 9, -4, 0, -18, -3, -7,
+    19, -31, -17, 17, 3, 0, 1, 15, -20, -17, 0, -14, 1, 0, 16, -8,
+    -12, -15, 23, 1, 19, -1, -16, -18, -3, 12, -9, 5, 0, 69, -32, -3,
+    29, 6, -6, 1, 5, -127, 24, -44, 1, -9, 7, 0, -44, -88, -24, 17,
+    -73, -4, 75, 10, 37, 6, 18, 0, 8, -26, 0, 7, 2, 13, -6, 5,
+    -2, -4, -5, 41, -10, -1, 0, -3, 22, 0, 5, 0, 9, -9, 3, 3,
+    -7, -1, 68, -38, 8, 0, 9, -26, 0, 12, 35, 75, -2, 26, 7, -34,
+    -5, 39, 34, -15, -6, -1, 19, 0, -49, -63, 33, 2, -47, -1, 27, 0,
+    -36, 24, -23, 3, -2, 36, 0, -27, 6, 35, 35, -13, 4, 3, 0, -18,
+    10, -26, -1, -1, 20, 0, -11, -19, 22, 81, 1, 9, 7, 0, 98, -55,
+    -17, 16, -2, 42, 0, 20, 7, 67, 29, 17, 9, -8, 0, -65, 28, -1,
+    17, -1, -12, 0, 17, -21, -51, 78, -7, 7, 38, 0, -119, -23, 2, -22,
+    1, 31, 0, -20, -71, -16, 13, -16, -15, 56, 0, -51, 9, -10, 1, 3,
+    -23, 0, 4, 15, -35, 0, 6, 4, -2, 4, -23, -12, -5, -4, 16, -23,
+    0, 0, -23, -15, -13, 1, -19, 3, -1, -55, 30, -8, 0, -9, -10, 0,
+    3, -33, -76, -7, -4, -14, 5, 4, -46, -1, 0, 6, 0, -23, 0, 12,
+    -21, -5, 3, -13, -8, 3, 0, 22, 70, 1, 9, 3, -55, 0, 11, 63,
+    0, 18, -13, 10, -10, 0, -35, 78, 5, 6, 2, -69, 0, 6, 47, -17,
+    -6, -17, 15, -5, 0, 22, 18, 5, 3, -6, -51, 0, 5, 23, 55, 11,
+    -9, 12, 1, 0, -45, 3, -14, -6, -8, 2, -1, -7, -13, -24, -24, -1,
+    -7, 13, 0, -64, -22, -13, -2, 6, 48, 0, 24, -32, -86, -29, -18, -19,
+    2, 0, -69, 3, -10, 0, 0, 0, 1, -17, -69, -47, 28, -53, 2, 19,
+    1, 3, -39, -13, 0, 0, -1, 1, -23, -33, 65, -2, -32, 4, 5, 1,
+    39, -47, -16, 0, 0, 6, 2, -46, -67, 80, 27, -51, 3, 28, 0, -1,
+    52, 25, 9, 9, -89, 0, 10, 80, -30, 3, 1, 37, 0, 12, -26, -4,
+    10, -4, -20, -2, 0, -10, 42, -8, -4, 20, -7, 0, 4, -117, -18, -1,
+    4, 1, 97, 0, 20, -45, -35, 28, -4, -33, 0, 14, 3, -3, -1, -1,
+    -1, 9, 0, -3, 11, -30, -11, 2, -5, -7, 0, 3, -22, -4, 2, 14,
+    -5, 0, 10, 8, 40, -21, 10, 4, -23, 0, -56, 26, 1, -1, -5, -8,
+    0, -34, -37, -111, 10, -17, 11, 33, 0, -76, -6, 3, -6, 20, 38, 0,
+    4, -76, -27, -14, 8, -3, 12, -3, 88, -61, -28, -21, -18, 74, 0, -7,
+    -17, 100, 0, 5, -2, 16, -3, 109, -24, -1, -15, 4, 10, 0, 0, 1,
+    25, -34, -8, 0, -3, -3, 43, -9, 19, 0, -1, -5, 0, 23, -4, -7,
+    -18, 8, 2, -2, 0, -8, 4, 5, 0, 7, -12, -1, 4, 30, -5, 11,
+    21, -4, -2, 0, -76, -10, -17, 0, 5, 40, -1, 23, -19, -31, -5, 13,
+    -11, 1, 0, 0, -10, 0, 0, 0, 30, 0, 7, -87, 10, 0, 0, 0,
+    0, 0, 0, 20, 0, 0, 0, -2, 0, 4, 29, -3, 0, 0, 0, 0,
+    0, 0, 44, 0, 0, 0, -99, 0, 2, 62, 7, 0, 0, 0, 0, 0,
+    -16, -4, 2, 0, 0, 1, 0, 15, -12, -25, -3, 4, -10, -5, -1, 14,
+    24, -1, 2, 0, -1, 0, -6, 8, 14, 18, 0, 15, -4, 1, -67, 14,
+    1, 5, 0, -1, 0, 4, 10, -16, 52, 8, 21, -5, 2, -17, 30, -1,
+    2, 5, -21, 0, 1, 45, 13, 12, 3, -2, -15, 0, -63, -30, 1, 3,
+    23, 67, 0, 16, -36, -41, -26, 16, -6, -15, 0, 13, -17, -21, 5, -24,
+    67, 0, -6, -37, 4, 68, -9, 2, 13, 0, -1, -2, -19, 0, 20, 5,
+    0, 4, -3, 1, -6, 7, -3, -7, 0, -76, 23, -18, 0, 8, -12, 0,
+    -2, 8, -17, 9, -5, 2, 0, 0, -89, -1, -8, 0, 0, 34, 0, -3,
+    -49, -95, 20, 14, 2, 12, 0, 1, 0, -3, 0, -1, 0, 0, -7, -30,
+    0, 33, -34, 0, 19, 0, -7, 0, -22, 0, 1, 3, 0, -32, -27, 33,
+    24, -26, 0, 19, 0, -21, 0, -26, 0, -14, 5, 0, -20, -83, 12, 32,
+    -54, 0, 46, 0, -56, 0, -13, -2, -9, -21, 0, -14, -9, -36, -4, -12,
+    3, 18, 0, 40, -39, -3, -2, 12, 10, 0, -1, 1, 47, 9, 7, -6,
+    1, 0, 101, -5, 7, 1, 5, -42, 0, 11, 11, 80, -14, -25, -3, -5,
+    0, 33, 5, 3, -3, 0, 19, 0, -16, -10, 8, 0, -14, 2, 3, 0,
+    18, 22, 28, 7, -10, 3, 0, 16, 14, -36, 0, 2, 7, -2, 0, 82,
+    -29, 4, -6, 5, 27, 0, -7, 19, 49, 0, 17, 1, -1, 0, -14, -3,
+    -6, 0, 0, -5, 0, 1, -27, 5, 27, -2, 4, 3, 3, 23, 1, 0,
+    0, 3, -9, 0, 5, -9, 9, 24, 1, -1, 2, 1, -72, 18, -4, 0,
+    2, 9, 0, 12, -17, -47, -4, -3, -8, 1, 2, 12, -40, 5, 0, -1,
+    5, 0, 5, 84, 1, 3, 42, -11, -47, 0, -29, -19, 6, 0, 5, -17,
+    0, 27, 37, -15, -40, 50, 6, -57, 0, -109, 125, 10, 0, -6, -37, 0,
+    -47, -42, -126, 63, -65, 33, 64, 0, 0, 19, 0, 0, 0, 14, 0, 0,
+    0, -20, 0, 16, 0, 0, 0, 0, -42, 0, 0, 0, 17, 0, 0, 0,
+    2, 0, 25, 0, 0, 0, 0, -28, 0, 0, 0, 89, 0, 0, 0, -21,
+    0, 4, 0, 0, 0, 25, -43, 0, 0, -3, 12, 0, 2, -18, -14, -22,
+    32, -3, 0, -1, 11, -98, 0, 0, -2, 10, 0, 5, -11, -10, -69, 66,
+    -15, 0, -2, 8, -95, 0, 0, 5, 7, 0, 4, -24, -1, -9, 59, -18,
+    0, -1, 13, 3, 3, -1, 0, 0, 0, 16, 52, -36, -20, 26, -2, -21,
+    0, -10, -10, -1, 5, 0, 0, 0, 15, -33, -16, -9, 1, 2, -5, 0,
+    -30, 17, 2, -5, 0, 0, 0, -53, -62, -71, 11, -33, 6, 27, 0, 44,
+    -95, 11, 0, 6, 4, 0, 3, -13, 30, -3, 10, -1, 1, 0, 33, -3,
+    -10, 0, -8, -9, 0, -47, -10, 58, 53, -26, -1, 10, 0, -59, -17, 33,
+    0, 3, -4, 0, 36, -10, -60, -67, 12, -7, 0, 0, 65, -48, -3, -5,
+    19, 46, 0, -6, -68, 38, 13, -8, -10, 11, -12, 4, -17, -5, -12, -17,
+    45, 0, -12, 1, 12, -48, 5, -3, -2, -7, 13, -66, 11, -9, 1, 18,
+    0, -2, -30, 6, -57, 47, -7, -6, -20, -19, 116, 5, 0, -14, -15, 0,
+    -11, 55, 1, 22, -2, 9, 0, 4, 28, -43, 0, 0, 6, 53, 0, 22,
+    22, -1, -32, 33, 0, 0, -16, -6, -115, 6, 0, -1, 71, 0, 44, -24,
+    1, -44, 76, -13, 0, -20,
+};
+static const i32 co2nn_l2conv_bias[30] PROGMEM = {
+    -70259, 26557, 46868, 48199, -3970, 6321, 107461, -111451,
+    5084, -5221, 101639, 122192, 30328, -37231, -27012, 159802,
+    -11756, 127447, -28698, 175972, -22948, 55449, -23657, 166841,
+    370745, 119243, 49518, 3635, -26840, 159659,
+};
+static const u8 co2nn_l2conv_shifts[30] PROGMEM = {
+    9, 8, 9, 10, 9, 10, 11, 9, 10, 9, 10, 10, 9, 10, 9, 12,
+    9, 10, 9, 10, 9, 10, 9, 11, 12, 11, 9, 10, 10, 10,
+};
+
+// L3FC: 1 step(s) of 150 channel(s) -> 15
+#define CO2NN_L3FC_INPUTS  150
+#define CO2NN_L3FC_OUTPUTS  15
+static const i8 co2nn_l3fc_weights[2250] PROGMEM = {
+    12, 16, 15, -3, -1, 3, 7, -1, -6, -7, -16, 27, -11, -24, 3, -1,
+    18, 11, -11, 10, 2, 3, 0, 8, -3, 13, -1, 2, 38, 10, 12, 18,
+    10, -11, -1, 12, -5, -10, -14, 14, -1, 14, -12, 2, 35, -13, 10, 5,
+    9, -12, 4, 17, 4, -17, 8, 9, -29, 14, 39, 26, -15, 26, -24, 23,
+    -2, 22, 26, -16, -33, 23, 46, 18, -14, 6, 29, -5, -13, 0, 0, 21,
+    36, 14, -2, -21, 10, 20, 5, -7, -6, 26, -8, 12, -58, 24, 1, -17,
+    6, 13, 21, 6, 44, -45, -4, 23, -4, 15, 15, -28, 6, 40, 43, -13,
+    24, -10, -10, 4, -23, 8, -6, -31, -7, 123, -15, -97, 127, 35, -40, -113,
+    5, -38, -10, -46, 5, 59, -7, 11, 37, -38, -7, -30, 8, 53, -24, -3,
+    -12, 1, -4, -4, 45, 31, -20, 46, 37, -18, 56, -3, -13, -35, 24, 19,
+    -32, -5, -22, 3, -16, 5, -9, 27, -31, -29, 10, 27, -45, -7, 6, -17,
+    7, -43, -27, 8, 26, 15, 12, 16, 11, 14, 7, -20, 9, -6, 26, 4,
+    2, 29, 38, 1, 8, 17, 19, -7, 19, -7, -13, 5, 3, 7, 12, -7,
+    30, 27, 25, -4, -45, 42, -28, 24, -1, 0, 23, -35, 41, 8, 37, -15,
+    24, -4, 28, 29, 17, 45, 7, -10, 7, 33, 3, -20, 29, -17, -6, -12,
+    2, -19, -57, -42, 18, -18, -17, -20, 6, -25, 11, -13, 12, 5, -23, -8,
+    10, -36, -29, -33, -1, 6, -2, -5, -1, 9, 3, 18, 15, -18, -16, -22,
+    -41, 36, -73, -24, 42, 73, 21, 92, -69, 27, -24, 5, 76, -3, 31, -55,
+    34, 11, -37, -49, 116, -15, -9, 2, -46, 111, -27, -79, -9, 24, 9, -5,
+    14, -1, -1, -17, -3, -2, 6, -13, -7, 25, -8, 2, -6, 17, -13, -3,
+    19, 14, -21, -8, 1, -5, 4, -12, 2, -6, 19, -20, 13, -8, 12, 1,
+    5, 10, -4, 15, 6, 2, 2, 0, -6, 0, -2, 0, 1, 0, -10, -5,
+    1, 1, -6, 1, 3, 3, 1, 35, -1, 23, -27, 0, 21, 17, -6, -27,
+    -15, -12, 12, -5, 6, 10, -4, -3, -1, 6, -7, 16, 12, -6, -15, -2,
+    1, -10, 11, 16, 12, -1, 10, -22, 12, -12, -19, 15, -11, -9, -1, -19,
+    20, 15, 6, 27, -4, -8, 18, -5, 17, -11, -5, 4, 6, 0, 3, -3,
+    -1, 9, 4, 14, -83, 48, 12, 32, -17, -8, 12, 14, 28, -33, -42, 5,
+    -19, -24, 38, 9, -12, -16, -60, -6, 9, 4, 29, 3, 3, 6, -26, -4,
+    -26, -32, 2, 24, 64, -11, -6, -16, 7, 19, -9, -39, -10, 22, -17, -22,
+    -17, 2, 8, -12, -21, 3, 25, -3, -10, 13, -2, 8, -9, -31, 3, -8,
+    1, -23, 40, -1, -13, -1, -9, 47, -30, 26, 15, 46, 1, -9, 4, -16,
+    -15, 39, -3, -15, 27, 10, -9, -11, 15, -4, -6, -31, -26, 33, -20, 19,
+    -14, 4, -6, 10, 27, 7, -29, 34, 33, -2, -32, 25, -5, -6, -20, -7,
+    -8, -14, 12, 15, 6, -30, 3, 16, -12, -12, -15, 0, -17, 30, -8, -12,
+    25, -28, -7, 30, 0, 41, 28, -32, -42, 46, -11, 6, -13, -23, -4, 1,
+    36, -10, -2, -38, -23, -1, -51, 18, -6, 15, 46, -9, 12, -34, 76, -13,
+    -68, 3, 44, -95, -55, -52, 123, -36, 60, 14, 67, -18, 46, -90, -92, 29,
+    -57, 66, 2, 6, 84, -74, -23, 64, 14, -18, -2, 11, -11, 10, -3, 8,
+    8, 8, 17, 12, -5, -2, -24, -7, 8, 26, 7, 10, 21, -3, 0, 15,
+    0, -22, 12, -31, -40, 4, 23, -27, 3, 31, -17, 21, 11, 4, -10, -1,
+    29, 4, -3, -20, -13, -1, -7, 18, 24, 21, 1, -10, 7, 18, -7, -12,
+    17, -24, -27, 9, 27, -2, -34, 9, 20, 12, -7, -17, -23, -8, 38, -6,
+    -6, -9, -25, -8, -29, 24, -11, 24, 37, -2, -12, 0, -4, -13, -7, -18,
+    10, 13, -21, -25, -38, -4, -12, -18, -15, -3, 17, -41, 42, -1, 19, 30,
+    -15, -5, 24, -13, -25, 3, 25, -14, -13, 16, 0, -3, 29, -7, 3, -26,
+    -5, 20, 13, 5, 3, -40, 7, 58, 5, 75, -87, 62, -58, -68, 59, 0,
+    -27, -4, -1, -46, -17, -5, 23, -15, -11, 9, -47, 26, -31, -9, 1, -10,
+    22, -13, -2, -4, 3, 14, 0, -20, -8, 9, 0, -25, 10, 0, -2, -22,
+    -12, 7, -6, -2, -5, 5, -13, 5, -6, 18, 5, -10, -15, 1, -7, -10,
+    -5, -15, -20, 18, -4, -9, -6, 16, 7, 13, 17, -4, -3, -1, -6, -6,
+    -12, 1, 3, 0, 8, 5, -5, 4, -9, -7, -14, 3, 2, 5, -4, -2,
+    17, 14, -5, 21, -13, 9, -9, 7, 10, 0, -7, -4, -6, -25, 1, 8,
+    -1, -14, 3, 14, 1, 6, -10, -9, 3, 14, 28, 21, -6, 7, 7, 26,
+    11, 26, -1, 9, -13, 10, 19, 10, -13, 26, 25, 25, 8, -8, 5, -8,
+    -1, 2, -14, 10, 0, 22, -8, -9, -6, -52, 51, 9, -34, -44, 32, -105,
+    13, -66, 58, -1, -55, 8, 18, 10, -28, -26, -19, 44, -37, 28, -14, -7,
+    34, -46, 17, 11, -2, 54, -37, 21, 12, -24, -7, -5, -79, -11, -9, 8,
+    -18, -7, 23, -16, -25, 34, -15, -7, 13, 8, -20, 9, 2, 46, 13, -38,
+    61, 21, -23, -2, -40, 11, -5, 28, 7, -15, -51, 4, 25, 21, -1, 58,
+    -22, -17, -10, 40, 3, 22, 41, -7, 17, -18, 16, 22, -10, 6, 53, 5,
+    -40, 39, -26, 9, 24, -2, 27, -33, -61, 1, -10, -19, -32, 23, -24, 2,
+    -37, 5, -38, 18, 30, 36, 14, -32, 15, 41, 2, -19, 50, -14, -22, 13,
+    -37, 13, -15, 7, 21, -8, 11, 3, 36, -63, -17, 54, -25, 15, 30, -62,
+    16, 55, 13, -39, 55, -22, -4, 5, -23, 17, 29, -60, 63, -1, 70, -69,
+    91, -39, -39, 8, 10, -2, -47, -12, 69, -59, 15, 14, 39, 0, 25, -85,
+    -73, 17, -60, 47, 4, 3, 52, -65, -10, 71, 46, -89, -22, -28, 27, 12,
+    19, -13, 56, 42, 13, -11, 1, -23, -34, 0, 24, -30, 45, 11, -46, -10,
+    20, -10, -23, -22, -9, 71, -5, -5, 32, -26, -17, -17, 19, -20, -22, -25,
+    31, -1, -41, -9, 21, -53, 22, 12, 22, -50, 3, -49, -69, -10, -43, 23,
+    -24, -4, 35, 42, -39, -13, 56, -92, 33, 25, -31, -31, -36, 23, -19, 7,
+    -29, -11, 44, -64, -27, 4, 9, 3, 26, 17, -15, -27, -31, 26, -17, -30,
+    25, -10, 1, -5, 30, -45, 0, -63, 27, -25, -24, -30, -55, -26, 45, 22,
+    -18, -15, -85, -17, -24, 15, -14, -59, 4, 29, -37, 17, -18, -3, 10, -3,
+    15, 19, -87, 3, -25, 32, -97, -33, 39, 45, 32, -41, -23, 18, -60, 7,
+    17, 19, -3, 27, -41, 52, 10, -15, 56, -16, -3, -1, -48, -1, -61, -76,
+    -23, 28, 5, 4, -6, 0, 9, -15, -20, -34, 30, -9, -3, 8, -4, -2,
+    -21, -21, -26, 17, 30, -4, -4, -2, -6, -6, -11, 27, 21, -32, -40, -8,
+    13, 0, -32, 1, -6, 9, 13, -12, 1, -3, -2, -7, -30, -2, -2, -5,
+    -14, 14, -6, 6, 10, 1, 0, -21, 0, 7, -32, -43, -15, -6, 39, 2,
+    -28, -1, 15, 5, 21, 15, -21, -5, -16, -1, -9, 8, 7, -22, 12, -18,
+    -23, 4, 10, -6, 1, 2, 2, 3, -19, -47, -6, 1, 72, 13, -7, -9,
+    -2, 34, -6, 35, -37, 4, -3, 14, 7, 2, -24, 23, 6, -2, -30, -21,
+    -9, 1, 2, -4, 11, -8, -15, 17, 59, -125, -7, -2, 1, 20, -16, 19,
+    7, -66, 16, -33, 94, -27, -23, -2, 58, 9, 74, -3, -73, -17, -47, 43,
+    0, -6, 80, -21, -9, 29, -19, 42, -43, 32, -7, 31, 7, -23, 0, -18,
+    22, 31, -15, 15, -4, -14, 4, 58, -10, 34, 22, 4, 5, 6, 3, 1,
+    11, -9, 13, -29, 16, -11, 45, 7, -21, 13, 2, -10, 2, 18, -4, 23,
+    -16, 15, -15, -10, 20, 20, 19, 15, 11, 11, 10, -12, 12, -9, -17, -8,
+    23, -5, -15, 45, 9, -7, -20, -16, 3, -11, 2, 0, 27, -10, -16, 50,
+    1, 8, 16, -15, -12, 0, 27, 7, 16, -11, 6, 12, -17, -16, 30, -24,
+    4, -16, -36, 34, -13, -50, 4, 46, -1, 32, 28, -20, 7, 13, -28, 2,
+    13, 14, 2, 17, 40, -32, -25, 5, -5, 7, 8, 5, -6, -19, -51, 119,
+    35, -69, 108, -34, -70, -75, 43, -83, -34, -38, 31, 25, -10, 11, 48, -46,
+    -61, -55, 29, 23, -61, 25, -3, -9, 28, -24, -19, 0, -11, 12, 15, -10,
+    -2, -1, -4, 2, 10, -23, -14, 18, -9, -11, 2, -1, 4, -3, -12, -2,
+    0, 0, 2, 7, -7, 7, -7, 10, 7, -10, -7, -8, 17, -1, -16, -1,
+    -11, 17, -2, 0, -3, 18, 2, 2, 11, -6, 2, 8, 7, 0, -1, -2,
+    4, -1, 6, 0, -3, -15, -11, 4, -3, 6, 3, 6, -20, 5, 19, 3,
+    -14, 18, -10, 0, -6, 5, 3, 3, -2, -2, 9, -2, -4, 3, 6, -16,
+    4, 8, -6, -1, 6, -8, -11, 18, 10, 2, 7, -11, 1, 11, -2, 17,
+    -15, -22, -11, 9, 2, 5, -5, -7, -4, -4, 8, -6, 2, -13, -5, 2,
+    -22, 4, 2, 11, 9, -15, 5, -15, 33, -4, -24, -26, 19, -64, 3, -39,
+    53, 10, -13, 3, 43, 1, 7, -7, -29, 4, -20, 27, 3, 0, 41, -31,
+    17, 9, 6, -14, 28, -11, -13, -4, 1, 15, -8, -15, -5, 21, -13, -30,
+    6, -4, -7, -6, 4, -3, -6, 2, -3, 3, -7, 14, -8, 12, 22, 2,
+    -9, -8, -8, -6, 0, -8, -5, 15, -18, 14, -13, 17, 1, -17, 12, -7,
+    -14, 7, -3, -6, -25, -3, 2, -5, 5, 0, 0, -1, -12, 6, -18, 3,
+    9, 5, 4, 5, 7, 2, -13, 1, -9, 6, 3, 20, 19, 5, -10, 6,
+    -2, -19, 4, 8, 11, -5, 8, 18, 5, -8, -4, 0, -16, 25, 12, 27,
+    -27, 32, 8, -14, 13, -2, 13, -5, 3, 28, 43, 8, 2, 12, 17, 27,
+    0, -5, 19, 1, 3, 1, -14, 4, 7, -2, 61, -75, -1, 7, 5, 24,
+    3, 14, -5, -21, 12, -28, 65, -47, -26, -5, 8, 27, 50, -4, -75, 10,
+    -12, 36, -3, -2, 64, -35, 8, 36, -21, 26, 8, 6, -29, -8, -5, -6,
+    -23, -30, -29, -4, -5, -23, 4, 5, 9, -15, -10, -7, -3, 1, 8, 10,
+    1, 12, -1, -17, 11, -21, -2, -34, 25, 0, -29, -20, -5, 27, -10, 17,
+    -12, 39, -1, -3, -7, -5, 11, 31, 8, -1, 7, -20, 11, -2, 15, -2,
+    -1, -25, -11, 19, -5, -4, 15, 3, -3, -3, 26, 13, -21, 25, -14, 19,
+    0, 17, 30, 7, -4, 15, 6, 3, 3, 2, -1, -16, 11, 13, 2, -11,
+    -4, 14, 3, 23, -26, 25, -20, 8, 20, -5, 2, 25, -9, -20, -11, -4,
+    8, 11, 10, 6, 11, 18, 0, 1, 21, -15, -7, 6, -22, 6, 4, -27,
+    52, -64, 10, -12, 41, -6, -22, 25, 23, -41, 6, -20, 82, -18, 13, -13,
+    54, -5, 52, -50, -71, -9, -15, 59, -4, 0, 71, -48, -25, 26, 28, -20,
+    12, 0, 1, 5, 13, -8, 14, 30, 33, -8, 23, 28, -7, 22, 6, 13,
+    4, 11, 16, -10, -9, -5, 8, -7, 14, 12, -1, 8, 25, -14, 2, -16,
+    4, -3, 2, -5, 11, 1, -16, -7, 0, -12, -17, 17, 5, -3, 4, -15,
+    -14, -10, -5, 12, -10, 2, 12, 10, 14, 3, -8, -4, 7, -2, 16, -29,
+    -35, -14, 10, -29, -20, -18, 24, 22, -23, 15, 21, -12, -13, 11, -17, -16,
+    -8, 19, 0, -6, 20, -4, 12, -14, 28, -10, 21, -8, -39, 11, 10, -16,
+    7, -15, -3, 12, 22, -32, -11, 4, 20, 4, 9, 17, -38, 6, 12, 29,
+    16, -2, 28, -16, 8, 0, -23, 25, -7, 20, -48, -16, 26, 23, -10, 26,
+    4, -7, -47, -1, 7, 6, -38, 7, -38, 19, 68, -9, 16, -21, 2, 6,
+    -41, -1, -9, -38, 1, 12, -13, 3, -1, 6, 0, -8, 17, 15, -4, -11,
+    4, 19, 14, 1, 7, 6, 14, -8, -10, 7, 6, -7, 8, -7, -3, -7,
+    -11, 3, 13, 11, 7, 2, 9, 2, 12, -10, 18, 1, -5, -11, 0, 0,
+    6, 4, 9, -5, 4, -2, 0, -1, -2, -1, -5, -2, 0, 0, 8, 11,
+    18, 13, -5, -3, 11, 0, -6, -6, 0, -3, 8, -1, 3, -8, 7, -4,
+    -1, 17, 0, 17, -1, 2, -10, 5, -3, -12, -2, -2, 16, 13, 13, -6,
+    -26, -6, -15, 6, 6, -11, -6, -11, 23, 3, 11, -3, -10, -9, 6, -2,
+    -3, 4, 0, 11, -5, 7, 1, -5, 14, -4, 2, -13, -64, 64, 12, 1,
+    10, -35, -6, 12, 2, 20, -23, 25, -46, 31, 41, 4, -35, -27, -65, -24,
+    61, -7, 23, -26, 7, 8, -51, 27, -12, -14,
+};
+static const i32 co2nn_l3fc_bias[15] PROGMEM = {
+    -18884, 80317, -18098, -198952, -110428, -37619, 108471, 37062,
+    -43146, -21519, -107652, -27544, 99968, 74105, -18803,
+};
+static const u8 co2nn_l3fc_shifts[15] PROGMEM = {
+    9, 10, 9, 11, 10, 9, 11, 12, 9, 10, 10, 9, 11, 11, 8,
+};
+
+// L4FC: 1 step(s) of 15 channel(s) -> 4
+#define CO2NN_L4FC_INPUTS  15
+#define CO2NN_L4FC_OUTPUTS  4
+static const i8 co2nn_l4fc_weights[60] PROGMEM = {
+    -95, 18, -13, -70, -1, -31, -16, -8, -24, -50, -7, -28, -24, 7, 9, -77,
+    42, 34, -12, 38, -72, 1, 3, -49, -39, -24, -23, -7, 5, 38, 75, -40,
+    -47, 28, -39, 55, 13, 3, 80, 40, 28, 53, 20, -13, -99, 67, -36, -39,
+    15, -22, 30, 25, -12, 64, 33, 11, 50, 12, -10, -69,
+};
+static const i32 co2nn_l4fc_bias[4] PROGMEM = {
+    -16503, -36302, -13406, -7592,
+};
+static const u8 co2nn_l4fc_shifts[4] PROGMEM = {
+    10, 8, 8, 7,
+};
+
+// Output: 1 step(s) of 4 channel(s) -> 1
+#define CO2NN_OUTPUT_INPUTS  4
+#define CO2NN_OUTPUT_OUTPUTS  1
+static const i8 co2nn_output_weights[4] PROGMEM = {
+    -10, -39, 50, 78,
+};
+static const i32 co2nn_output_bias[1] PROGMEM = {
+    115471,
+};
+static const u8 co2nn_output_shifts[1] PROGMEM = {
+    6,
+};
@@ -0,0 +1,26 @@
+///////////////////////////////////////////////////////////////////
+// Host shim of <avr/eeprom.h>. EEMEM variables are ordinary variables that keep
+// their contents for the lifetime of the simulation (EEPROM starts empty, i.e. zeroed).
+///////////////////////////////////////////////////////////////////
+
+#ifndef AK_SIM_AVR_EEPROM_H
+#define AK_SIM_AVR_EEPROM_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define EEMEM
+
+#define eeprom_read_byte(p)         (*(const uint8_t *)(p))
+#define eeprom_read_word(p)         (*(const uint16_t *)(p))
+#define eeprom_read_block(d, s, n)  memcpy((d), (s), (n))
+
+#define eeprom_update_byte(p, v)      (*(uint8_t *)(p) = (v))
+#define eeprom_update_word(p, v)      (*(uint16_t *)(p) = (v))
+#define eeprom_update_block(s, d, n)  memcpy((d), (s), (n))
+
+#define eeprom_write_byte   eeprom_update_byte
+#define eeprom_write_word   eeprom_update_word
+#define eeprom_write_block  eeprom_update_block
+
+#endif
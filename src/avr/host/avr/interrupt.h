@@ -0,0 +1,18 @@
+///////////////////////////////////////////////////////////////////
+// Host shim of <avr/interrupt.h>. ISR is an ordinary function that sim.c calls.
+///////////////////////////////////////////////////////////////////
+
+#ifndef AK_SIM_AVR_INTERRUPT_H
+#define AK_SIM_AVR_INTERRUPT_H
+
+#include <avr/io.h>
+
+#define sei()  (SREG |= (1 << SREG_I))
+#define cli()  (SREG &= (uint8_t)~(1 << SREG_I))
+
+#define ISR_BLOCK
+#define ISR_NAKED
+
+#define ISR(vector, ...)  void vector(void); void vector(void)
+
+#endif
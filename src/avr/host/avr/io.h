@@ -0,0 +1,186 @@
+///////////////////////////////////////////////////////////////////
+// Host shim of <avr/io.h> for ATmega2560, only what firmware uses.
+// Registers live in sim_io (see sim.c) at their data memory addresses.
+///////////////////////////////////////////////////////////////////
+
+#ifndef AK_SIM_AVR_IO_H
+#define AK_SIM_AVR_IO_H
+
+#include "sim.h"
+
+// - - - - - - - - - - - - - GPIO
+// PIN is calculated from PORT and DDR (inputs are pulled up, there is nothing connected)
+
+#define SIM_GPIO_PORT(pin_addr)  SIM_IO8((pin_addr) + 2)
+#define SIM_GPIO_DDR(pin_addr)   SIM_IO8((pin_addr) + 1)
+
+#define PINA   sim_read_pin(0x20)
+#define DDRA   SIM_IO8(0x21)
+#define PORTA  SIM_IO8(0x22)
+#define PINB   sim_read_pin(0x23)
+#define DDRB   SIM_IO8(0x24)
+#define PORTB  SIM_IO8(0x25)
+#define PINC   sim_read_pin(0x26)
+#define DDRC   SIM_IO8(0x27)
+#define PORTC  SIM_IO8(0x28)
+#define PIND   sim_read_pin(0x29)
+#define DDRD   SIM_IO8(0x2A)
+#define PORTD  SIM_IO8(0x2B)
+#define PINE   sim_read_pin(0x2C)
+#define DDRE   SIM_IO8(0x2D)
+#define PORTE  SIM_IO8(0x2E)
+#define PINF   sim_read_pin(0x2F)
+#define DDRF   SIM_IO8(0x30)
+#define PORTF  SIM_IO8(0x31)
+#define PING   sim_read_pin(0x32)
+#define DDRG   SIM_IO8(0x33)
+#define PORTG  SIM_IO8(0x34)
+#define PINH   sim_read_pin(0x100)
+#define DDRH   SIM_IO8(0x101)
+#define PORTH  SIM_IO8(0x102)
+#define PINJ   sim_read_pin(0x103)
+#define DDRJ   SIM_IO8(0x104)
+#define PORTJ  SIM_IO8(0x105)
+#define PINK   sim_read_pin(0x106)
+#define DDRK   SIM_IO8(0x107)
+#define PORTK  SIM_IO8(0x108)
+#define PINL   sim_read_pin(0x109)
+#define DDRL   SIM_IO8(0x10A)
+#define PORTL  SIM_IO8(0x10B)
+
+// Writing one into PIN bit toggles PORT bit
+#define sim_write_PINA(v)  sim_toggle_port(0x20, (v))
+#define sim_write_PINB(v)  sim_toggle_port(0x23, (v))
+#define sim_write_PINC(v)  sim_toggle_port(0x26, (v))
+#define sim_write_PIND(v)  sim_toggle_port(0x29, (v))
+#define sim_write_PINE(v)  sim_toggle_port(0x2C, (v))
+#define sim_write_PINF(v)  sim_toggle_port(0x2F, (v))
+#define sim_write_PING(v)  sim_toggle_port(0x32, (v))
+#define sim_write_PINH(v)  sim_toggle_port(0x100, (v))
+#define sim_write_PINJ(v)  sim_toggle_port(0x103, (v))
+#define sim_write_PINK(v)  sim_toggle_port(0x106, (v))
+#define sim_write_PINL(v)  sim_toggle_port(0x109, (v))
+
+#define SIM_PORT_BITS(p) \
+    enum { P##p##0 = 0, P##p##1 = 1, P##p##2 = 2, P##p##3 = 3, P##p##4 = 4, P##p##5 = 5, P##p##6 = 6, P##p##7 = 7 };
+
+SIM_PORT_BITS(A) SIM_PORT_BITS(B) SIM_PORT_BITS(C) SIM_PORT_BITS(D) SIM_PORT_BITS(E) SIM_PORT_BITS(F)
+SIM_PORT_BITS(G) SIM_PORT_BITS(H) SIM_PORT_BITS(J) SIM_PORT_BITS(K) SIM_PORT_BITS(L)
+
+// - - - - - - - - - - - - - Status and reset
+
+#define SREG   SIM_IO8(0x5F)
+#define SREG_I 7
+
+#define MCUSR  SIM_IO8(0x54)
+#define PORF   0
+#define EXTRF  1
+#define BORF   2
+#define WDRF   3
+
+// - - - - - - - - - - - - - Timer1 (CTC, used by akat for deciseconds)
+
+#define TIFR1   SIM_IO8(0x36)
+#define TIMSK1  SIM_IO8(0x6F)
+#define TCCR1A  SIM_IO8(0x80)
+#define TCCR1B  SIM_IO8(0x81)
+#define TCNT1   sim_read_TCNT1()
+#define OCR1A   SIM_IO16(0x88)
+
+#define TOV1    0
+#define OCF1A   1
+#define OCF1B   2
+#define TOIE1   0
+#define OCIE1A  1
+#define OCIE1B  2
+#define CS10    0
+#define CS11    1
+#define CS12    2
+#define WGM12   3
+#define WGM13   4
+
+// - - - - - - - - - - - - - Timer2 (PH dither)
+
+#define TCCR2A  SIM_IO8(0xB0)
+#define TCCR2B  SIM_IO8(0xB1)
+#define TCNT2   SIM_IO8(0xB2)
+#define OCR2A   SIM_IO8(0xB3)
+#define OCR2B   SIM_IO8(0xB4)
+
+#define WGM20   0
+#define WGM21   1
+#define COM2B0  4
+#define COM2B1  5
+#define COM2A0  6
+#define COM2A1  7
+#define CS20    0
+#define CS21    1
+#define CS22    2
+#define WGM22   3
+
+// - - - - - - - - - - - - - Timer4 (light dimmers)
+
+#define TCCR4A  SIM_IO8(0xA0)
+#define TCCR4B  SIM_IO8(0xA1)
+#define TCNT4   SIM_IO16(0xA4)
+#define ICR4    SIM_IO16(0xA6)
+#define OCR4A   SIM_IO16(0xA8)
+#define OCR4B   SIM_IO16(0xAA)
+
+#define WGM40   0
+#define WGM41   1
+#define COM4B0  4
+#define COM4B1  5
+#define COM4A0  6
+#define COM4A1  7
+#define CS40    0
+#define CS41    1
+#define CS42    2
+#define WGM42   3
+#define WGM43   4
+
+// - - - - - - - - - - - - - ADC
+
+#define ADC     SIM_IO16(0x78)
+#define ADCSRA  SIM_IO8(0x7A)
+#define ADCSRB  SIM_IO8(0x7B)
+#define ADMUX   SIM_IO8(0x7C)
+
+#define ADPS0   0
+#define ADPS1   1
+#define ADPS2   2
+#define ADIE    3
+#define ADIF    4
+#define ADATE   5
+#define ADSC    6
+#define ADEN    7
+#define ADLAR   5
+#define REFS0   6
+#define REFS1   7
+
+// - - - - - - - - - - - - - USART0
+
+#define UCSR0A  SIM_IO8(0xC0)
+#define UCSR0B  SIM_IO8(0xC1)
+#define UCSR0C  SIM_IO8(0xC2)
+#define UBRR0L  SIM_IO8(0xC4)
+#define UBRR0H  SIM_IO8(0xC5)
+#define UDR0    SIM_IO8(0xC6)
+
+#define MPCM0   0
+#define U2X0    1
+#define UPE0    2
+#define DOR0    3
+#define FE0     4
+#define UDRE0   5
+#define TXC0    6
+#define RXC0    7
+#define TXEN0   3
+#define RXEN0   4
+#define UDRIE0  5
+#define TXCIE0  6
+#define RXCIE0  7
+#define UCSZ00  1
+#define UCSZ01  2
+
+#endif
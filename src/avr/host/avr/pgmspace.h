@@ -0,0 +1,22 @@
+///////////////////////////////////////////////////////////////////
+// Host shim of <avr/pgmspace.h>, there is only one address space on host.
+///////////////////////////////////////////////////////////////////
+
+#ifndef AK_SIM_AVR_PGMSPACE_H
+#define AK_SIM_AVR_PGMSPACE_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define PSTR(s)  (s)
+
+#define pgm_read_byte(p)   (*(const uint8_t *)(p))
+#define pgm_read_word(p)   (*(const uint16_t *)(p))
+#define pgm_read_dword(p)  (*(const uint32_t *)(p))
+#define pgm_read_float(p)  (*(const float *)(p))
+
+#define memcpy_P  memcpy
+#define strlen_P  strlen
+
+#endif
@@ -0,0 +1,480 @@
+#!/usr/bin/env python3
+
+# AVR stand-in on a pseudo-terminal, so the server can run without hardware (AKUA_PORT=<link>).
+#
+# Source of the bytes is either:
+#   - the native firmware build (--firmware ./firmware-host, see host/sim.c), it runs with --realtime
+#     and gets commands from the terminal, so it's the real firmware talking the real protocol
+#   - a scripted model (default) that writes status lines built from serial-protocol.txt with the
+#     version of src/jsclient/server/avr/protocol.ts and answers commands like the firmware does,
+#     at any --rate (AVR at 9600 baud manages ~8 binary or 3..5 text status lines per second), it keeps
+#     writing text status lines even if the server asks for binary ones ('S' command)
+#
+# Faults are injected into lines on the way to the terminal: wrong CRC, trace lines (with random
+# records of tracepoints from serial-protocol.txt), bursts of lines written back to back and stalls
+# (nothing is written, lines are dropped).
+#
+# Every --stats seconds it prints lines/bytes written and commands received to stderr.
+#
+# E.g. 'python3 src/avr/host/emulator.py --rate 100 --crc-error-rate 0.01' and then
+# 'AKUA_PORT=/tmp/akua-avr ./start'.
+
+import argparse
+import os
+import random
+import re
+import select
+import signal
+import subprocess
+import sys
+import time
+import tty
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", "..")
+PROTOCOL_FILENAME = os.path.join(ROOT, "serial-protocol.txt")
+PROTOCOL_TS_FILENAME = os.path.join(ROOT, "src", "jsclient", "server", "avr", "protocol.ts")
+
+# A1: Misc: u32 uptime_deciseconds
+FIELD_RE = re.compile(r"^([A-Z])(\d+): [^:]+: (u8|u16|u32) (.+)$")
+VERSION_RE = re.compile(r"avrProtocolVersion = 0x([0-9a-fA-F]+)")
+
+# %1: Trace: ClockCorrected(i32 driftDeciseconds, i16 trimPpmX8): ...
+TRACE_RE = re.compile(r"^%(\d+): Trace: \w+\(([^)]*)\)")
+TYPE_BYTES = {"u8": 1, "u16": 2, "u32": 4, "i16": 2, "i32": 4}
+
+# See AK_PROTOCOL_ESCAPE in protocol.h
+ESCAPE = 0x7D
+
+# <Xarg Xarg>, see 'read_command' in main.c
+COMMAND_RE = re.compile(rb"<([A-Z])(\d{0,3})\1(\d{0,3})>")
+
+# Must be in harmony with the firmware (see AK_TIMER1_NOMINAL_TOP, AK_TIME_SYNC_*, UploadTarget)
+TICKS_PER_PERIOD = 25000
+PHASE_UNIT_TICKS = 98
+PH_CALIBRATION_UPLOAD = 1
+SCHEDULE_PROFILE_UPLOAD = 2
+CO2_CURVE_UPLOAD = 3
+CO2NN_CONFIG_UPLOAD = 4
+SCHEDULE_PROFILES = 4
+EVENTS_PER_LINE = 8
+EVENT_CO2_SWITCHED = 4
+EVENT_LIGHT_FORCED = 6
+EVENT_CO2_FORCED_OFF = 7
+
+# Host keeps required CO2 state by sending 'G' every second, see AK_* timeouts in main.c
+FORCE_SECONDS = 60 * 60
+REQUIRED_CO2_SECONDS = 60
+
+
+# akat_crc_add: Dallas/Maxim CRC8
+def crc_add(crc: int, byte: int) -> int:
+    for _ in range(8):
+        m = (crc ^ byte) & 1
+        crc >>= 1
+        if m:
+            crc ^= 0x8C
+        byte >>= 1
+    return crc
+
+
+def crc_of(data: bytes) -> int:
+    crc = 0
+    for b in data:
+        crc = crc_add(crc, b)
+    return crc
+
+
+# Like format_and_send_*: shortest hex, zero is an empty string
+def fmt(v: int) -> str:
+    return "%x" % v if v else ""
+
+
+def read_protocol():
+    fields = []
+    with open(PROTOCOL_FILENAME) as f:
+        for line in f:
+            m = FIELD_RE.match(line.strip())
+            if m:
+                fields.append((m.group(1), int(m.group(2)), m.group(3), m.group(4)))
+
+    with open(PROTOCOL_TS_FILENAME) as f:
+        version = int(VERSION_RE.search(f.read()).group(1), 16)
+
+    return fields, version
+
+
+# [(id, [arg sizes])]
+def read_tracepoints():
+    tracepoints = []
+    with open(PROTOCOL_FILENAME) as f:
+        for line in f:
+            m = TRACE_RE.match(line.strip())
+            if m:
+                args = [a.split(" ")[0] for a in m.group(2).split(", ") if a]
+                tracepoints.append((int(m.group(1)), [TYPE_BYTES[a] for a in args]))
+    return tracepoints
+
+
+# Like the '%' line of usart0_writer: periods, records and CRC, escaped like binary status
+def trace_line(tracepoints, periods: int) -> bytes:
+    data = periods.to_bytes(4, "little")
+    for _ in range(random.randint(1, 3)):
+        tid, sizes = random.choice(tracepoints)
+        data += bytes([tid]) + (periods & 0xFFFF).to_bytes(2, "little") + bytes([random.randint(0, 2)])
+        data += bytes(random.randint(0, 255) for _ in range(sum(sizes)))
+
+    out = bytearray(b"%")
+    for b in data + bytes([crc_of(data)]):
+        if b in (0x0D, 0x0A, ESCAPE):
+            out += bytes([ESCAPE, b ^ 0x20])
+        else:
+            out.append(b)
+    return bytes(out) + b"\r\n"
+
+
+class Model:
+    def __init__(self, fields, version: int):
+        self.fields = fields
+        self.version = version
+        self.started = time.monotonic()
+        # Added to our time to get AVR time, changed by 'P'
+        self.phase_seconds = 0.0
+        self.clock_offset_deciseconds = 0
+        self.received_clock = [0, 0, 0]
+
+        self.co2_required_until = 0.0
+        self.co2_forced_off_until = 0.0
+        self.light_forced_until = 0.0
+        self.light_force_mode = 0
+        self.schedule_profile = 0
+        self.temperature_update_id = 0
+
+        self.upload = []
+        self.upload_errors = 0
+        self.ph_calibration_crc = None
+        self.co2_curve_crc = 0
+        self.co2nn_config_crc = None
+        self.schedule_profiles = [None] * SCHEDULE_PROFILES
+
+        self.events = []
+        self.log_event(1, 0)
+
+    def seconds(self) -> float:
+        return time.monotonic() - self.started + self.phase_seconds
+
+    def periods_and_ticks(self):
+        periods = int(self.seconds() * 10)
+        return periods, int((self.seconds() * 10 - periods) * TICKS_PER_PERIOD)
+
+    def clock_deciseconds(self) -> int:
+        t = time.localtime()
+        return ((t.tm_hour * 60 + t.tm_min) * 60 + t.tm_sec) * 10 + self.clock_offset_deciseconds
+
+    def log_event(self, code: int, arg: int):
+        self.events.append((self.periods_and_ticks()[0], code, arg))
+
+    def values(self) -> dict:
+        now = self.seconds()
+        co2_on = now < self.co2_required_until and now >= self.co2_forced_off_until
+        day = 8 * 36000 <= self.clock_deciseconds() % 864000 < 20 * 36000
+        ph = 6.8 + (0.3 if not co2_on else 0) + random.uniform(-0.01, 0.01)
+        self.temperature_update_id = (self.temperature_update_id + 1) & 0xFF
+
+        values = {
+            "uptime_deciseconds": int(now * 10),
+            "main_loop_iterations_in_last_decisecond": 5000 + random.randint(-50, 50),
+            "clock_deciseconds_since_midnight": self.clock_deciseconds() % 864000,
+            "upload_errors": self.upload_errors,
+            "mcusr_at_startup": 1,
+            "events_next_seq": len(self.events) & 0xFF,
+            "ds18b20_aqua.get_temperatureX16()": 25 * 16 + random.randint(-1, 1),
+            "ds18b20_aqua.get_update_id()": self.temperature_update_id,
+            "ds18b20_aqua.get_updated_deciseconds_ago()": 3,
+            "ds18b20_case.get_temperatureX16()": 30 * 16 + random.randint(-1, 1),
+            "ds18b20_case.get_update_id()": self.temperature_update_id,
+            "ds18b20_case.get_updated_deciseconds_ago()": 3,
+            "co2_switch.is_set() ? 1 : 0": int(co2_on),
+            "co2_calculated_day ? 1 : 0": int(day),
+            "is_timer_armed(Co2ForceOffTimer) ? 1 : 0": int(now < self.co2_forced_off_until),
+            "is_timer_armed(RequiredCo2SwitchStateTimer) ? 1 : 0": int(now < self.co2_required_until),
+            "day_light_switch.is_set() ? 1 : 0": int(day or (now < self.light_forced_until and self.light_force_mode == 1)),
+            "night_light_switch.is_set() ? 1 : 0": int(not day),
+            "is_timer_armed(DayLightForcedTimer) ? 1 : 0": int(now < self.light_forced_until),
+            "schedule_profile": self.schedule_profile,
+            "schedule_crc": self.schedule_crc(),
+            "dimmer_levels[DayLightDimmer]": 255 if day else 0,
+            "dimmer_levels[NightLightDimmer]": 0 if day else 255,
+            # Batch is closed every 5 deciseconds (AK_PH_BATCH_DECISECONDS) and has ~19 decimated samples
+            "__ph_adc_batch.tick": int(now * 2) * 5,
+            "__ph_adc_batch.accum": int(2.5 / 5.0 * 16384) * 19,
+            "__ph_adc_batch.samples": 19,
+            "ph_q16": int(ph * 65536) if self.ph_calibration_crc is not None else 0,
+            "ph_compensation_temperatureX16": 25 * 16,
+            "ph_calibration_valid": int(self.ph_calibration_crc is not None),
+            "ph_calibration_crc": self.ph_calibration_crc or 0,
+            "ph_short_window_q16": int(ph * 65536) if self.ph_calibration_crc is not None else 0,
+            "ph_window_short_seconds": min(int(now), 60),
+            "ph_long_window_q16": int(ph * 65536) if self.ph_calibration_crc is not None else 0,
+            "ph_window_long_seconds": min(int(now), 600),
+            "co2_curve_crc": self.co2_curve_crc,
+            "co2nn_config_valid": int(self.co2nn_config_crc is not None),
+            "co2nn_config_crc": self.co2nn_config_crc or 0,
+        }
+        return values
+
+    def schedule_crc(self) -> int:
+        if None in self.schedule_profiles:
+            return 0
+        return crc_of(bytes(b for p in self.schedule_profiles for b in p))
+
+    def status_line(self) -> bytes:
+        values = self.values()
+        out = ""
+        for letter, idx, argt, expr in self.fields:
+            out += (" " + letter) if idx == 1 else ","
+            v = values.get(expr, 0)
+            out += fmt(v & {"u8": 0xFF, "u16": 0xFFFF, "u32": 0xFFFFFFFF}[argt])
+        out += " " + fmt(self.version) + " "
+        return (out + fmt(crc_of(out.encode())) + "\r\n").encode()
+
+    def events_line(self, seq: int) -> bytes:
+        next_seq = len(self.events) & 0xFF
+        available = (next_seq - seq) & 0xFF
+        if available > len(self.events) or available > 64:
+            seq = (next_seq - min(len(self.events), 64)) & 0xFF
+
+        out = "!" + fmt(self.periods_and_ticks()[0]) + "," + fmt(seq)
+        for i in range(EVENTS_PER_LINE):
+            if (seq + i) & 0xFF == next_seq:
+                break
+            tick, code, arg = self.events[len(self.events) - ((next_seq - seq - i) & 0xFF)]
+            out += "," + fmt(tick) + "," + fmt(code) + "," + fmt(arg)
+        out += " "
+        return (out + fmt(crc_of(out.encode())) + "\r\n").encode()
+
+    def time_sync_reply(self, seq: int, rx) -> bytes:
+        tx = self.periods_and_ticks()
+        out = "=" + ",".join(fmt(v) for v in (seq, rx[0], rx[1], tx[0], tx[1], self.clock_deciseconds() % 864000)) + " "
+        return (out + fmt(crc_of(out.encode())) + "\r\n").encode()
+
+    def commit_upload(self, target: int):
+        payload, crc = self.upload[:-1], self.upload[-1] if self.upload else None
+        if crc is None or crc_of(bytes(payload)) != crc:
+            self.upload_errors += 1
+        elif target == PH_CALIBRATION_UPLOAD:
+            self.ph_calibration_crc = crc
+        elif target == SCHEDULE_PROFILE_UPLOAD and payload and payload[0] < SCHEDULE_PROFILES:
+            self.schedule_profiles[payload[0]] = payload[1:]
+        elif target == CO2_CURVE_UPLOAD:
+            self.co2_curve_crc = crc
+        elif target == CO2NN_CONFIG_UPLOAD and len(payload) == 1 and payload[0] <= 1:
+            self.co2nn_config_crc = crc
+        else:
+            self.upload_errors += 1
+        self.upload = []
+
+    # Returns lines to write in reply, rx is the time when the command was received
+    def on_command(self, code: str, arg: int, rx) -> list:
+        now = self.seconds()
+        if code == 'G':
+            was_on = now < self.co2_required_until
+            self.co2_required_until = now + REQUIRED_CO2_SECONDS if arg else 0
+            if bool(arg) != was_on:
+                self.log_event(EVENT_CO2_SWITCHED, arg)
+        elif code == 'F':
+            self.co2_forced_off_until = now + FORCE_SECONDS
+            self.log_event(EVENT_CO2_FORCED_OFF, 0)
+        elif code == 'L':
+            self.light_force_mode = arg
+            self.light_forced_until = now + FORCE_SECONDS if arg else 0
+            self.log_event(EVENT_LIGHT_FORCED, arg)
+        elif code == 'D':
+            self.schedule_profile = arg
+        elif code in 'AB':
+            self.received_clock["ABC".index(code)] = arg
+        elif code == 'C':
+            self.received_clock[2] = arg
+            clock = self.received_clock[0] | (self.received_clock[1] << 8) | (self.received_clock[2] << 16)
+            self.clock_offset_deciseconds += clock - self.clock_deciseconds() % 864000
+        elif code == 'U':
+            self.upload.append(arg)
+        elif code == 'V':
+            self.commit_upload(arg)
+        elif code == 'T':
+            return [self.time_sync_reply(arg, rx)]
+        elif code == 'P':
+            self.phase_seconds += ((arg - 256) if arg > 127 else arg) * PHASE_UNIT_TICKS / TICKS_PER_PERIOD / 10
+        elif code == 'E':
+            return [self.events_line(arg)]
+        return []
+
+
+class Faults:
+    def __init__(self, args):
+        self.args = args
+        self.next_burst = time.monotonic() + args.burst_every if args.burst_every else None
+        self.next_stall = time.monotonic() + args.stall_every if args.stall_every else None
+        self.stalled_until = 0.0
+        self.tracepoints = read_tracepoints()
+        self.started = time.monotonic()
+
+    # Returns lines to write instead of the line
+    def apply(self, line: bytes) -> list:
+        now = time.monotonic()
+
+        if self.next_stall and now >= self.next_stall:
+            self.stalled_until = now + self.args.stall_seconds
+            self.next_stall = now + self.args.stall_every
+        if now < self.stalled_until:
+            return []
+
+        lines = []
+        if random.random() < self.args.trace_rate:
+            lines.append(trace_line(self.tracepoints, int((now - self.started) * 10)))
+
+        if random.random() < self.args.crc_error_rate and line.rfind(b" ") > 1:
+            # Flip a bit of a payload character, CRC stays as it was
+            i = random.randint(1, line.rfind(b" ") - 1)
+            line = line[:i] + bytes([line[i] ^ 1]) + line[i + 1:]
+        lines.append(line)
+
+        if self.next_burst and now >= self.next_burst:
+            lines.extend([line] * self.args.burst_lines)
+            self.next_burst = now + self.args.burst_every
+
+        return lines
+
+
+class Stats:
+    def __init__(self):
+        self.lines = 0
+        self.bytes = 0
+        self.commands = 0
+        self.dropped = 0
+        self.started = time.monotonic()
+        self.reported = self.started
+
+    def report(self, force: bool, interval: float):
+        now = time.monotonic()
+        if not force and now - self.reported < interval:
+            return
+        seconds = max(now - self.reported, 1e-6)
+        print("emulator: %.1f lines/s, %.0f bytes/s, %d commands, %d lines dropped (nobody reads)"
+              % (self.lines / seconds, self.bytes / seconds, self.commands, self.dropped), file=sys.stderr, flush=True)
+        self.lines = self.bytes = self.commands = self.dropped = 0
+        self.reported = now
+
+
+def open_pty(link: str):
+    master, slave = os.openpty()
+    tty.setraw(slave)
+    os.set_blocking(master, False)
+    if os.path.lexists(link):
+        os.remove(link)
+    os.symlink(os.ttyname(slave), link)
+    return master, slave
+
+
+# Like a serial port, bytes are lost if nobody reads them
+def write_all(fd: int, data: bytes) -> bool:
+    try:
+        while data:
+            data = data[os.write(fd, data):]
+    except BlockingIOError:
+        return False
+    return True
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--link", default="/tmp/akua-avr", help="Symlink to the pseudo-terminal")
+    parser.add_argument("--firmware", help="Native firmware build to run instead of the model")
+    parser.add_argument("--rate", type=float, default=7, help="Status lines per second of the model")
+    parser.add_argument("--crc-error-rate", type=float, default=0, help="Probability of a wrong CRC in a line")
+    parser.add_argument("--trace-rate", type=float, default=0, help="Probability of a trace line before a line")
+    parser.add_argument("--burst-every", type=float, default=0, help="Seconds between bursts")
+    parser.add_argument("--burst-lines", type=int, default=50, help="Extra copies of a line in a burst")
+    parser.add_argument("--stall-every", type=float, default=0, help="Seconds between stalls")
+    parser.add_argument("--stall-seconds", type=float, default=5, help="Duration of a stall")
+    parser.add_argument("--stats", type=float, default=10, help="Seconds between statistics")
+    parser.add_argument("--seed", type=int)
+    args = parser.parse_args()
+
+    random.seed(args.seed)
+    master, slave = open_pty(args.link)
+    print("emulator: AVR is at", args.link, "->", os.ttyname(slave), file=sys.stderr, flush=True)
+
+    firmware = None
+    model = None
+    if args.firmware:
+        firmware = subprocess.Popen([args.firmware, "--realtime", "--seconds", "1e9"], stdin=subprocess.PIPE, stdout=subprocess.PIPE, bufsize=0)
+    else:
+        model = Model(*read_protocol())
+
+    signal.signal(signal.SIGTERM, lambda *_: sys.exit(0))
+
+    faults = Faults(args)
+    stats = Stats()
+    received = b""
+    output = b""
+    next_line = time.monotonic()
+
+    def emit(line: bytes):
+        for l in faults.apply(line):
+            if write_all(master, l):
+                stats.lines += 1
+                stats.bytes += len(l)
+            else:
+                stats.dropped += 1
+
+    try:
+        while True:
+            fds = [master] + ([firmware.stdout] if firmware else [])
+            timeout = max(0.0, next_line - time.monotonic()) if model else 1.0
+            readable, _, _ = select.select(fds, [], [], min(timeout, args.stats))
+
+            if master in readable:
+                try:
+                    data = os.read(master, 4096)
+                except OSError:
+                    # Nobody has the terminal open
+                    data = b""
+                    time.sleep(0.1)
+
+                if firmware:
+                    firmware.stdin.write(data)
+                else:
+                    received = (received + data)[-256:]
+                    rx = model.periods_and_ticks()
+                    processed = 0
+                    for m in COMMAND_RE.finditer(received):
+                        processed = m.end()
+                        if m.group(2) != m.group(3) or int(m.group(2) or 0) > 255:
+                            continue
+                        stats.commands += 1
+                        for r in model.on_command(m.group(1).decode(), int(m.group(2) or 0), rx):
+                            emit(r)
+                    received = received[processed:]
+
+            if firmware and firmware.stdout in readable:
+                data = firmware.stdout.read(4096)
+                if not data:
+                    print("emulator: Firmware exited with code", firmware.wait(), file=sys.stderr)
+                    sys.exit(1)
+                output += data
+                while b"\n" in output:
+                    line, output = output.split(b"\n", 1)
+                    emit(line + b"\n")
+
+            if model and time.monotonic() >= next_line:
+                emit(model.status_line())
+                next_line += 1 / args.rate
+                # Don't try to catch up after being suspended
+                next_line = max(next_line, time.monotonic() - 1)
+
+            stats.report(False, args.stats)
+    finally:
+        if firmware:
+            firmware.kill()
+        if os.path.islink(args.link):
+            os.remove(args.link)
@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+
+# Converts firmware.tmp.c (as generated by akatpp for AVR) into C code that can be compiled natively
+# and linked with sim.c (see Makefile, 'firmware-host' target). It only touches things that can't be
+# done by shim headers (see host/avr/*.h):
+#   - global register variables (register u8 x asm ("r16")) become ordinary globals
+#   - known inline assembler snippets of akat are replaced with their C equivalents
+#   - writes into registers with side effects (see HOOKED_REGISTERS and PINx) become sim_write_*() calls
+#   - main() becomes firmware_main() and its endless loop calls sim_main_loop_step()
+# Any other inline assembler is an error, so we never silently compile something else.
+
+import re
+import sys
+
+# Registers where write does more than storing the value (write-one-to-clear flags, transmission, etc)
+HOOKED_REGISTERS = ["UDR0", "UCSR0A", "ADCSRA", "TIFR1", "TCNT1", "OCR1A"]
+
+REGISTER_VAR_RE = re.compile(r'^register\s+(\w+)\s+(\w+)\s+asm\s*\(\s*"r\d+"\s*\)\s*;', re.MULTILINE)
+
+# Writing one into PINx toggles PORTx bit. '|=' is compiled into SBI (so only the given bits are written)
+# and '&=' into CBI (writes nothing) for the ports akat uses this way.
+PIN_WRITE_RE = re.compile(r'\b(PIN[A-L])\s*(\|=|&=|=)(?!=)\s*([^;]+);')
+
+HOOKED_WRITE_RE = re.compile(r'\b(' + '|'.join(HOOKED_REGISTERS) + r')\s*(\|=|&=|=)(?!=)\s*([^;]+);')
+
+MAIN_RE = re.compile(r'\bvoid\s+main\s*\(\s*\)\s*\{')
+
+# akat's delay loops take 3 (dec/brne) and 4 (sbiw/brne) cycles per iteration
+DELAY_ASM_RE = re.compile(r'__asm__\s+volatile\s*\(\s*"1:\s*(dec|sbiw)[^;]*?\)\s*;', re.DOTALL)
+
+KNOWN_ASM = [
+    # akat's AKAT_FLUSH_REG_VAR tells gcc that the variable is changed by ISR
+    (re.compile(r'asm\s+volatile\s*\(\s*""\s*:\s*"=r"\s*\(\s*vvv\s*\)\s*\)\s*;'), 'sim_flush_reg_var(vvv);'),
+    # akat sets r2 to 1 for AKAT_ONE
+    (re.compile(r'asm\s+volatile\s*\(\s*"EOR r2, r2\\nINC r2"\s*:\s*"=r"\s*\(\s*(\w+)\s*\)\s*\)\s*;'), r'\1 = 1;'),
+    # Naked ISR of akat's decisecond timer
+    (re.compile(r'asm\s+volatile\s*\(\s*"ldi %0, 0x01"\s*:\s*"=r"\s*\(\s*(\w+)\s*\)\s*\)\s*;'), r'\1 = 1;'),
+    (re.compile(r'asm\s+volatile\s*\(\s*"reti"\s*\)\s*;'), ''),
+    # Naked USART0_RX_vect of main.c
+    (re.compile(r'asm\s+volatile\s*\(\s*"push r30\\n".*?\(\s*__vector_usart0_rx_time_sync\s*\)\s*\)\s*;', re.DOTALL),
+     'const u8 usart0_rx_isr_byte = UDR0;'
+     ' usart0_rx_bytes_buf[usart0_rx_next_empty_idx] = usart0_rx_isr_byte;'
+     ' if ((u8)(usart0_rx_next_empty_idx + 1) != usart0_rx_next_read_idx) { usart0_rx_next_empty_idx += 1; }'
+     ' else if (usart0_rx_overflow_count != 0xFF) { usart0_rx_overflow_count += 1; }'
+     ' if (usart0_rx_isr_byte == \'T\') { __vector_usart0_rx_time_sync(); }'),
+]
+
+
+def hostify(src: str) -> str:
+    src = REGISTER_VAR_RE.sub(r'\1 \2;', src)
+
+    for regex, replacement in KNOWN_ASM:
+        src = regex.sub(replacement, src)
+
+    src = DELAY_ASM_RE.sub(lambda m: 'sim_delay_cycles((u32)__count * ' + ('3' if m.group(1) == 'dec' else '4') + ');', src)
+
+    src = HOOKED_WRITE_RE.sub(lambda m: 'sim_write_' + m.group(1) + '(' + {
+        '=': '',
+        '|=': m.group(1) + ' | ',
+        '&=': m.group(1) + ' & '
+    }[m.group(2)] + '(' + m.group(3).strip() + '));', src)
+
+    src = PIN_WRITE_RE.sub(lambda m: 'sim_write_' + m.group(1) + '('
+                           + ('0' if m.group(2) == '&=' else '(' + m.group(3).strip() + ')') + ');', src)
+
+    main = MAIN_RE.search(src)
+    if not main:
+        raise ValueError("main() is not found")
+
+    loop = src.find("while (1) {", main.end())
+    if loop < 0:
+        raise ValueError("Endless loop of main() is not found")
+
+    loop += len("while (1) {")
+    src = src[:main.start()] + "void firmware_main() {" + src[main.end():loop] + "\n        sim_main_loop_step();" + src[loop:]
+
+    leftover = re.search(r'\b(asm|__asm__)\b.*', src)
+    if leftover:
+        raise ValueError("Unsupported inline assembler: " + leftover.group(0))
+
+    return src
+
+
+if __name__ == '__main__':
+    with open(sys.argv[1]) as f:
+        src = f.read()
+
+    try:
+        sys.stdout.write(hostify(src))
+    except ValueError as e:
+        sys.stderr.write("hostify: " + str(e) + "\n")
+        sys.exit(1)
@@ -0,0 +1,494 @@
+///////////////////////////////////////////////////////////////////
+// Native (host) simulation of the firmware.
+//
+// Firmware (hostified by hostify.py) runs in this process against registers in sim_io.
+// Time is virtual: every iteration of the firmware main loop takes --loop-cycles CPU cycles
+// (and so do akat delays), peripherals are advanced by that number of cycles and pending
+// interrupts are dispatched between iterations. So simulated time doesn't depend on how fast
+// the host is and days of controller behaviour are simulated in seconds.
+//
+// Peripherals: Timer1 (CTC, OCF1A interrupt), ADC (free running or single conversion, ADC interrupt, value is
+// --adc plus noise), USART0 (TX bytes go to stdout, RX bytes come from --input script),
+// GPIO (inputs are pulled up, nothing is connected), watchdog (simulation fails if it fires).
+//
+// Input script has lines like '<seconds> <bytes to send>', e.g. '10.5 <G1G1>', sorted by time.
+//
+// With --realtime simulated time is kept in step with wall clock and bytes from stdin are received
+// by USART0 as they come (see host/emulator.py that connects it to a pseudo-terminal).
+///////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+#define SIM_F_CPU  16000000UL
+
+#define H(v)  (1 << (v))
+
+volatile uint8_t sim_io[SIM_IO_SIZE];
+
+// Firmware (see hostify.py)
+extern void firmware_main(void) __attribute__((noreturn));
+
+// ISRs firmware might have
+extern void TIMER1_COMPA_vect(void) __attribute__((weak));
+extern void USART0_RX_vect(void) __attribute__((weak));
+extern void ADC_vect(void) __attribute__((weak));
+
+typedef struct {
+    uint64_t cycle;
+    char *bytes;
+} SimInput;
+
+static struct {
+    double seconds;
+    uint32_t loop_cycles;
+    uint16_t adc;
+    uint16_t adc_noise;
+    const char *input;
+    int quiet;
+    int realtime;
+} sim_options = {60, 1000, 512, 2, NULL, 0, 0};
+
+static uint64_t sim_cycles;
+static uint64_t sim_end_cycles;
+static uint64_t sim_main_loop_iterations;
+static uint8_t sim_in_isr;
+
+static uint16_t sim_timer1_counter;
+static uint32_t sim_timer1_remainder;
+
+static uint32_t sim_adc_remaining_cycles;
+static uint32_t sim_adc_rng = 2463534242UL;
+
+static uint64_t sim_usart0_tx_ready_cycle;
+static uint64_t sim_usart0_rx_next_cycle;
+static uint64_t sim_usart0_tx_bytes;
+
+static SimInput *sim_inputs;
+static size_t sim_inputs_count;
+static size_t sim_input_idx;
+static size_t sim_input_offset;
+
+static uint64_t sim_realtime_next_cycle;
+static struct timespec sim_realtime_started;
+
+static uint8_t sim_wdt_enabled;
+static uint64_t sim_wdt_timeout_cycles;
+static uint64_t sim_wdt_reset_cycle;
+
+// - - - - - - - - - - - - - - - - - - - - - - - - Timer1
+
+static uint16_t sim_timer1_prescaler(void) {
+    static const uint16_t prescalers[8] = {0, 1, 8, 64, 256, 1024, 0, 0};
+    return prescalers[TCCR1B & (H(CS12) | H(CS11) | H(CS10))];
+}
+
+static void sim_timer1_advance(uint32_t cycles) {
+    const uint16_t prescaler = sim_timer1_prescaler();
+    if (!prescaler) {
+        return;
+    }
+
+    sim_timer1_remainder += cycles;
+    uint32_t ticks = sim_timer1_remainder / prescaler;
+    sim_timer1_remainder %= prescaler;
+
+    // Mode 4 (CTC with OCR1A as TOP) or normal mode
+    const uint8_t ctc = (TCCR1B & H(WGM12)) && !(TCCR1B & H(WGM13));
+
+    while (ticks) {
+        const uint32_t top = ctc ? OCR1A : 0xFFFF;
+        const uint32_t match = OCR1A;
+
+        // Counter is beyond TOP if TOP was moved below it, then it runs up to 0xFFFF
+        const uint32_t until_wrap = sim_timer1_counter <= top ? top - sim_timer1_counter + 1 : 0x10000 - sim_timer1_counter;
+
+        if (sim_timer1_counter <= match && match < sim_timer1_counter + (ticks < until_wrap ? ticks : until_wrap)) {
+            TIFR1 |= H(OCF1A);
+        }
+
+        if (ticks < until_wrap) {
+            sim_timer1_counter += ticks;
+            break;
+        }
+
+        ticks -= until_wrap;
+        sim_timer1_counter = 0;
+    }
+}
+
+uint16_t sim_read_TCNT1(void) {
+    return sim_timer1_counter;
+}
+
+void sim_write_TCNT1(uint16_t v) {
+    sim_timer1_counter = v;
+}
+
+void sim_write_OCR1A(uint16_t v) {
+    OCR1A = v;
+}
+
+// Flags are cleared by writing one
+void sim_write_TIFR1(uint8_t v) {
+    TIFR1 &= (uint8_t)~v;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - ADC
+
+static uint32_t sim_adc_conversion_cycles(void) {
+    const uint8_t adps = ADCSRA & (H(ADPS2) | H(ADPS1) | H(ADPS0));
+    return 13UL * (adps ? (1UL << adps) : 2UL);
+}
+
+static uint16_t sim_adc_sample(void) {
+    // xorshift32
+    sim_adc_rng ^= sim_adc_rng << 13;
+    sim_adc_rng ^= sim_adc_rng >> 17;
+    sim_adc_rng ^= sim_adc_rng << 5;
+
+    int32_t v = sim_options.adc;
+    if (sim_options.adc_noise) {
+        v += (int32_t)(sim_adc_rng % (2UL * sim_options.adc_noise + 1)) - sim_options.adc_noise;
+    }
+
+    return v < 0 ? 0 : (v > 1023 ? 1023 : (uint16_t)v);
+}
+
+static void sim_adc_advance(uint32_t cycles) {
+    while ((ADCSRA & H(ADEN)) && (ADCSRA & H(ADSC))) {
+        if (cycles < sim_adc_remaining_cycles) {
+            sim_adc_remaining_cycles -= cycles;
+            return;
+        }
+
+        cycles -= sim_adc_remaining_cycles;
+        ADC = sim_adc_sample();
+        ADCSRA |= H(ADIF);
+
+        if (ADCSRA & H(ADATE)) {
+            sim_adc_remaining_cycles = sim_adc_conversion_cycles();
+        } else {
+            ADCSRA &= (uint8_t)~H(ADSC);
+        }
+    }
+}
+
+// ADIF is cleared by writing one, ADSC can't be cleared by writing zero
+void sim_write_ADCSRA(uint8_t v) {
+    const uint8_t old = ADCSRA;
+
+    ADCSRA = (v & (uint8_t)~(H(ADIF) | H(ADSC))) | (old & H(ADIF) & (uint8_t)~v) | ((old | v) & H(ADSC));
+
+    if ((v & H(ADSC)) && !(old & H(ADSC))) {
+        sim_adc_remaining_cycles = sim_adc_conversion_cycles();
+    }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - USART0
+
+static uint64_t sim_usart0_byte_cycles(void) {
+    const uint32_t ubrr = ((uint32_t)UBRR0H << 8) | UBRR0L;
+    return 10ULL * (ubrr + 1) * ((UCSR0A & H(U2X0)) ? 8 : 16);
+}
+
+void sim_write_UDR0(uint8_t v) {
+    if (!(UCSR0B & H(TXEN0))) {
+        return;
+    }
+
+    if (!sim_options.quiet) {
+        putchar(v);
+    }
+
+    sim_usart0_tx_bytes += 1;
+    UCSR0A &= (uint8_t)~(H(UDRE0) | H(TXC0));
+    sim_usart0_tx_ready_cycle = sim_cycles + sim_usart0_byte_cycles();
+}
+
+// Only U2X0 and MPCM0 are writable, TXC0 is cleared by writing one
+void sim_write_UCSR0A(uint8_t v) {
+    UCSR0A = (UCSR0A & (uint8_t)~(H(U2X0) | H(MPCM0) | (v & H(TXC0)))) | (v & (H(U2X0) | H(MPCM0)));
+}
+
+static void sim_usart0_advance(void) {
+    if (!(UCSR0A & H(UDRE0)) && sim_cycles >= sim_usart0_tx_ready_cycle) {
+        UCSR0A |= H(UDRE0) | H(TXC0);
+    }
+
+    if (!(UCSR0B & H(RXEN0)) || sim_input_idx >= sim_inputs_count || sim_cycles < sim_usart0_rx_next_cycle) {
+        return;
+    }
+
+    const SimInput *input = &sim_inputs[sim_input_idx];
+    if (sim_cycles < input->cycle) {
+        return;
+    }
+
+    if (UCSR0A & H(RXC0)) {
+        // Previous byte is not read yet, the new one is lost
+        UCSR0A |= H(DOR0);
+    } else {
+        UDR0 = (uint8_t)input->bytes[sim_input_offset];
+        UCSR0A |= H(RXC0);
+    }
+
+    sim_usart0_rx_next_cycle = sim_cycles + sim_usart0_byte_cycles();
+
+    sim_input_offset += 1;
+    if (!input->bytes[sim_input_offset]) {
+        sim_input_idx += 1;
+        sim_input_offset = 0;
+    }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - GPIO
+
+uint8_t sim_read_pin(uint16_t pin_addr) {
+    return (SIM_GPIO_PORT(pin_addr) & SIM_GPIO_DDR(pin_addr)) | (uint8_t)~SIM_GPIO_DDR(pin_addr);
+}
+
+void sim_toggle_port(uint16_t pin_addr, uint8_t bits) {
+    SIM_GPIO_PORT(pin_addr) ^= bits;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - Watchdog
+
+void sim_wdt_enable(uint8_t timeout) {
+    // WDTO_15MS is 2K cycles of 128kHz oscillator, every next one is twice as long
+    sim_wdt_timeout_cycles = (SIM_F_CPU / 64) << timeout;
+    sim_wdt_reset_cycle = sim_cycles;
+    sim_wdt_enabled = 1;
+}
+
+void sim_wdt_disable(void) {
+    sim_wdt_enabled = 0;
+}
+
+void sim_wdt_reset(void) {
+    sim_wdt_reset_cycle = sim_cycles;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - Real time
+
+static double sim_seconds(void) {
+    return (double)sim_cycles / SIM_F_CPU;
+}
+
+static void sim_add_input(uint64_t cycle, const char *bytes) {
+    sim_inputs = realloc(sim_inputs, (sim_inputs_count + 1) * sizeof(SimInput));
+    sim_inputs[sim_inputs_count].cycle = cycle;
+    sim_inputs[sim_inputs_count].bytes = strdup(bytes);
+    sim_inputs_count += 1;
+}
+
+// Called every simulated millisecond: sleeps if we are ahead of wall clock and takes bytes from stdin
+static void sim_realtime_sync(void) {
+    if (sim_cycles < sim_realtime_next_cycle) {
+        return;
+    }
+    sim_realtime_next_cycle = sim_cycles + SIM_F_CPU / 1000;
+
+    fflush(stdout);
+
+    // Protocol is text, so there are no zero bytes
+    char buf[256];
+    const ssize_t n = read(STDIN_FILENO, buf, sizeof(buf) - 1);
+    if (n > 0) {
+        buf[n] = 0;
+        sim_add_input(sim_cycles, buf);
+    } else if (n == 0) {
+        exit(0);
+    }
+
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    const double wall = (double)(now.tv_sec - sim_realtime_started.tv_sec) + (now.tv_nsec - sim_realtime_started.tv_nsec) / 1e9;
+    const double ahead = sim_seconds() - wall;
+    if (ahead > 0) {
+        const struct timespec delay = {(time_t)ahead, (long)((ahead - (double)(time_t)ahead) * 1e9)};
+        nanosleep(&delay, NULL);
+    }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - Core
+
+static void sim_call_isr(void (*isr)(void)) {
+    const uint8_t sreg = SREG;
+
+    sim_in_isr = 1;
+    SREG &= (uint8_t)~H(SREG_I);
+    isr();
+    SREG = sreg;
+    sim_in_isr = 0;
+}
+
+static void sim_dispatch_interrupts(void) {
+    if (sim_in_isr || !(SREG & H(SREG_I))) {
+        return;
+    }
+
+    // In the order of vector numbers
+    if ((TIFR1 & H(OCF1A)) && (TIMSK1 & H(OCIE1A)) && TIMER1_COMPA_vect) {
+        TIFR1 &= (uint8_t)~H(OCF1A);
+        sim_call_isr(TIMER1_COMPA_vect);
+    }
+
+    if ((UCSR0A & H(RXC0)) && (UCSR0B & H(RXCIE0)) && USART0_RX_vect) {
+        // ISR reads UDR0 which clears RXC0
+        sim_call_isr(USART0_RX_vect);
+        UCSR0A &= (uint8_t)~H(RXC0);
+    }
+
+    if ((ADCSRA & H(ADIF)) && (ADCSRA & H(ADIE)) && ADC_vect) {
+        // Flag is cleared by hardware when the interrupt is taken
+        ADCSRA &= (uint8_t)~H(ADIF);
+        sim_call_isr(ADC_vect);
+    }
+}
+
+static void sim_advance(uint32_t cycles) {
+    sim_cycles += cycles;
+
+    sim_timer1_advance(cycles);
+    sim_adc_advance(cycles);
+    sim_usart0_advance();
+
+    if (sim_wdt_enabled && sim_cycles - sim_wdt_reset_cycle > sim_wdt_timeout_cycles) {
+        fflush(stdout);
+        fprintf(stderr, "sim: Watchdog reset at %.3f seconds\n", sim_seconds());
+        exit(3);
+    }
+
+    if (sim_options.realtime) {
+        sim_realtime_sync();
+    }
+
+    sim_dispatch_interrupts();
+}
+
+void sim_delay_cycles(uint32_t cycles) {
+    sim_advance(cycles);
+}
+
+void sim_main_loop_step(void) {
+    static clock_t started;
+
+    if (!sim_main_loop_iterations) {
+        started = clock();
+    }
+
+    sim_main_loop_iterations += 1;
+    sim_advance(sim_options.loop_cycles);
+
+    if (sim_cycles >= sim_end_cycles) {
+        const double wall = (double)(clock() - started) / CLOCKS_PER_SEC;
+
+        fflush(stdout);
+        fprintf(stderr, "sim: Simulated %.1f seconds in %.3f seconds (x%.0f), %llu main loop iterations, %llu bytes sent\n",
+                sim_seconds(), wall, wall > 0 ? sim_seconds() / wall : 0,
+                (unsigned long long)sim_main_loop_iterations, (unsigned long long)sim_usart0_tx_bytes);
+        exit(0);
+    }
+}
+
+static void sim_load_input(const char *filename) {
+    FILE *f = fopen(filename, "r");
+    if (!f) {
+        perror(filename);
+        exit(2);
+    }
+
+    char *line = NULL;
+    size_t line_size = 0;
+    while (getline(&line, &line_size, f) >= 0) {
+        line[strcspn(line, "\r\n")] = 0;
+
+        char *bytes;
+        const double seconds = strtod(line, &bytes);
+        if (bytes == line || *bytes != ' ' || !bytes[1]) {
+            continue;
+        }
+
+        sim_add_input((uint64_t)(seconds * SIM_F_CPU), bytes + 1);
+    }
+
+    free(line);
+    fclose(f);
+}
+
+static void sim_usage(const char *name) {
+    fprintf(stderr,
+            "Usage: %s [--seconds N] [--loop-cycles N] [--adc N] [--adc-noise N] [--input FILE] [--quiet] [--realtime]\n"
+            "  --seconds      Simulated time (default %.0f)\n"
+            "  --loop-cycles  CPU cycles per iteration of firmware main loop (default %u)\n"
+            "  --adc          ADC value of PH sensor, 0..1023 (default %u)\n"
+            "  --adc-noise    Max noise added to ADC value (default %u)\n"
+            "  --input        Script of bytes sent to USART0: '<seconds> <bytes>' per line\n"
+            "  --quiet        Don't print bytes sent by firmware\n"
+            "  --realtime     Run as fast as wall clock, receive bytes from stdin\n",
+            name, sim_options.seconds, sim_options.loop_cycles, sim_options.adc, sim_options.adc_noise);
+    exit(2);
+}
+
+int main(int argc, char **argv) {
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+
+        if (!strcmp(arg, "--quiet")) {
+            sim_options.quiet = 1;
+            continue;
+        }
+
+        if (!strcmp(arg, "--realtime")) {
+            sim_options.realtime = 1;
+            continue;
+        }
+
+        if (!value) {
+            sim_usage(argv[0]);
+        }
+
+        i += 1;
+
+        if (!strcmp(arg, "--seconds")) {
+            sim_options.seconds = atof(value);
+        } else if (!strcmp(arg, "--loop-cycles")) {
+            sim_options.loop_cycles = (uint32_t)atol(value);
+        } else if (!strcmp(arg, "--adc")) {
+            sim_options.adc = (uint16_t)atoi(value);
+        } else if (!strcmp(arg, "--adc-noise")) {
+            sim_options.adc_noise = (uint16_t)atoi(value);
+        } else if (!strcmp(arg, "--input")) {
+            sim_options.input = value;
+        } else {
+            sim_usage(argv[0]);
+        }
+    }
+
+    if (sim_options.input) {
+        sim_load_input(sim_options.input);
+    }
+
+    sim_end_cycles = (uint64_t)(sim_options.seconds * SIM_F_CPU);
+
+    if (sim_options.realtime) {
+        fcntl(STDIN_FILENO, F_SETFL, fcntl(STDIN_FILENO, F_GETFL) | O_NONBLOCK);
+        clock_gettime(CLOCK_MONOTONIC, &sim_realtime_started);
+    }
+
+    // Reset values of registers
+    MCUSR = H(PORF);
+    UCSR0A = H(UDRE0);
+    UCSR0C = H(UCSZ01) | H(UCSZ00);
+
+    firmware_main();
+}
@@ -0,0 +1,51 @@
+///////////////////////////////////////////////////////////////////
+// Native (host) simulation of the firmware, see sim.c
+///////////////////////////////////////////////////////////////////
+
+#ifndef AK_SIM_H
+#define AK_SIM_H
+
+#include <stdint.h>
+
+// avr-gcc has 24-bit integers, we use wider ones (firmware never relies on 24-bit wrapping)
+#define __int24 int32_t
+#define __uint24 uint32_t
+
+#define __ATTR_NORETURN__  __attribute__((noreturn))
+#define __ATTR_CONST__     __attribute__((const))
+#define __ATTR_PURE__      __attribute__((pure))
+
+// I/O space of ATmega2560 (data memory addresses), see host/avr/io.h
+#define SIM_IO_SIZE  0x140
+
+extern volatile uint8_t sim_io[SIM_IO_SIZE];
+
+#define SIM_IO8(addr)   (sim_io[(addr)])
+#define SIM_IO16(addr)  (*(volatile uint16_t *)&sim_io[(addr)])
+
+// Called by firmware (code is inserted by hostify.py)
+void sim_main_loop_step(void);
+void sim_delay_cycles(uint32_t cycles);
+
+// Registers with side effects on write (calls are inserted by hostify.py)
+void sim_write_UDR0(uint8_t v);
+void sim_write_UCSR0A(uint8_t v);
+void sim_write_ADCSRA(uint8_t v);
+void sim_write_TIFR1(uint8_t v);
+void sim_write_TCNT1(uint16_t v);
+void sim_write_OCR1A(uint16_t v);
+
+// Registers that are calculated on read
+uint16_t sim_read_TCNT1(void);
+uint8_t sim_read_pin(uint16_t pin_addr);
+void sim_toggle_port(uint16_t pin_addr, uint8_t bits);
+
+void sim_wdt_enable(uint8_t timeout);
+void sim_wdt_disable(void);
+void sim_wdt_reset(void);
+
+// Global register variables are ordinary variables on host, ISR is a function call,
+// so we only need to prevent reordering.
+#define sim_flush_reg_var(v)  __asm__ volatile ("" ::: "memory")
+
+#endif
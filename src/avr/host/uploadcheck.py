@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+
+# Uploads schedule, PH calibration, CO2 curve and CO2 NN config into the native firmware build
+# (see Makefile, 'uploadcheck' target) the same way AvrService does and checks that CRCs the firmware
+# reports converge to CRCs of uploaded bytes with no upload errors. So the native build must lay out
+# uploaded structures exactly like AVR does (packed, little-endian).
+
+import argparse
+import os
+import struct
+import subprocess
+import sys
+import tempfile
+
+from emulator import read_protocol, crc_of, fmt, PH_CALIBRATION_UPLOAD, SCHEDULE_PROFILE_UPLOAD, CO2_CURVE_UPLOAD, \
+    CO2NN_CONFIG_UPLOAD, SCHEDULE_PROFILES
+
+# Must be in harmony with AK_SCHEDULE_MAX_TRANSITIONS
+SCHEDULE_MAX_TRANSITIONS = 8
+
+# (minute, ScheduleOutput bits)
+SCHEDULE = [(0, 2), (7 * 60, 6), (8 * 60, 5), (20 * 60, 2)]
+
+UPLOAD_PERIOD_SECONDS = 1
+SETTLE_SECONDS = 3
+
+
+def u16s(*values) -> bytes:
+    return b"".join(struct.pack("<H", v) for v in values)
+
+
+def schedule_profile_bytes() -> bytes:
+    transitions = b"".join(struct.pack("<HB", m, o) for m, o in SCHEDULE)
+    return bytes([len(SCHEDULE)]) + transitions.ljust(SCHEDULE_MAX_TRANSITIONS * 3, b"\0")
+
+
+# Like createPhCalibrationUpload: PH 7 at 2.5V, PH 4.01 at 3V, 25C, lockout below 6.6 with 0.1 hysteresis
+def ph_calibration_bytes() -> bytes:
+    return u16s(7000, 8192, 4010, 9830, 25 * 16, 6600, 100)
+
+
+# Like createCo2CurveUpload: fallback mode
+def co2_curve_bytes() -> bytes:
+    return bytes([1]) + struct.pack("<ffff", -0.5, 7.0, -0.01, 6.9) + u16s(7 * 60, 8 * 60, 20 * 60, 100)
+
+
+# Like serializeCommands: payload with its CRC as 'U' commands, then 'V' commit
+def upload_commands(target: int, payload: bytes) -> str:
+    return "".join("<U" + str(b or "") + "U" + str(b or "") + ">" for b in payload + bytes([crc_of(payload)])) \
+        + "<V" + str(target) + "V" + str(target) + ">"
+
+
+# Values of the last text status line with a valid CRC by 'expr' of protocol.json
+def last_status(output: bytes, fields, version: int) -> dict:
+    values = None
+    for line in output.split(b"\r\n"):
+        text = line.decode("latin1")
+        if not text.startswith(" A"):
+            continue
+
+        subject, _, crc = text.rpartition(" ")
+        sections = subject.split(" ")[1:-1]
+        if fmt(crc_of((subject + " ").encode("latin1"))) != crc or subject.split(" ")[-1] != fmt(version):
+            continue
+
+        parsed = {s[0]: s[1:].split(",") for s in sections}
+        values = {expr: int(parsed[letter][idx - 1] or "0", 16) for letter, idx, _, expr in fields}
+    return values
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--firmware", default="./firmware-host", help="Native firmware build")
+    args = parser.parse_args()
+
+    fields, version = read_protocol()
+
+    profile = schedule_profile_bytes()
+    uploads = [(SCHEDULE_PROFILE_UPLOAD, bytes([i]) + profile) for i in range(SCHEDULE_PROFILES)] + [
+        (PH_CALIBRATION_UPLOAD, ph_calibration_bytes()),
+        (CO2_CURVE_UPLOAD, co2_curve_bytes()),
+        (CO2NN_CONFIG_UPLOAD, bytes([1]))
+    ]
+
+    expected = {
+        "schedule_crc": crc_of(profile * SCHEDULE_PROFILES),
+        "ph_calibration_crc": crc_of(ph_calibration_bytes()),
+        "co2_curve_crc": crc_of(co2_curve_bytes()),
+        "co2nn_config_crc": crc_of(bytes([1])),
+        "upload_errors": 0
+    }
+
+    # One upload per second, like AvrService writes them
+    with tempfile.NamedTemporaryFile("w", suffix=".txt") as script:
+        for i, (target, payload) in enumerate(uploads):
+            script.write("%d %s\n" % ((i + 1) * UPLOAD_PERIOD_SECONDS, upload_commands(target, payload)))
+        script.flush()
+
+        seconds = (len(uploads) + 1) * UPLOAD_PERIOD_SECONDS + SETTLE_SECONDS
+        output = subprocess.run([args.firmware, "--seconds", str(seconds), "--input", script.name],
+                                stdout=subprocess.PIPE, check=True).stdout
+
+    values = last_status(output, fields, version)
+    if values is None:
+        print("uploadcheck: No valid status line", file=sys.stderr)
+        sys.exit(1)
+
+    failed = False
+    for expr, value in expected.items():
+        ok = values[expr] == value
+        failed = failed or not ok
+        print("%-20s %4s (expected %s)%s" % (expr, values[expr], value, "" if ok else " FAILED"))
+
+    sys.exit(1 if failed else 0)
@@ -0,0 +1,18 @@
+///////////////////////////////////////////////////////////////////
+// Host shim of <util/atomic.h>
+///////////////////////////////////////////////////////////////////
+
+#ifndef AK_SIM_UTIL_ATOMIC_H
+#define AK_SIM_UTIL_ATOMIC_H
+
+#include <avr/interrupt.h>
+
+#define ATOMIC_RESTORESTATE  1
+#define ATOMIC_FORCEON       2
+
+#define ATOMIC_BLOCK(type) \
+    for (uint8_t __sim_sreg = SREG, __sim_todo = (cli(), 1); \
+         __sim_todo; \
+         SREG = ((type) == ATOMIC_FORCEON ? (SREG | (1 << SREG_I)) : __sim_sreg), __sim_todo = 0)
+
+#endif
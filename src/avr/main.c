@@ -1,4 +1,12 @@
 #include <avr/io.h>
+#include <avr/eeprom.h>
+#include <avr/pgmspace.h>
+#include <avr/wdt.h>
+#include <math.h>
+
+// - - - - - - - - - - - -  - - -
+// Intervals below only define the default schedule (see 'Schedule'), which is used
+// until host uploads its own one.
 
 // - - - - - - - - - - - -  - - -
 // Day interval. Affects day-light and night light modes.
@@ -26,6 +34,12 @@
 // CO2-Day interval. Interval when it's allowed to feed CO2 to aquarium
 #define AK_CO2_DAY_PRE_START_HOURS  2
 
+// - - - - - - - - - - - -  - - -
+// Schedule. Every profile is a list of transitions (sorted by time of day),
+// the 'D' command selects the profile.
+#define AK_SCHEDULE_PROFILES  4
+#define AK_SCHEDULE_MAX_TRANSITIONS  8
+
 // Minimum minutes when CO2 can be turned again after it was turned off
 #define AK_CO2_OFF_MINUTES_BEFORE_UNLOCKED  15
 
@@ -35,6 +49,67 @@
 #define AK_PH_SENSOR_MIN_ADC  204
 #define AK_PH_SENSOR_MAX_ADC  820
 
+// PH sensor oversampling and decimation.
+// Every decimated sample is a sum of 4^AK_PH_OVERSAMPLING_BITS raw 10-bit conversions
+// shifted right by AK_PH_OVERSAMPLING_BITS. So we get (10 + AK_PH_OVERSAMPLING_BITS)-bit samples.
+// ADC is free running at 16Mhz / 128 / 13 = ~9615 conversions per second and every conversion
+// is taken by ISR(ADC_vect), so with 4 bits we produce 14-bit samples at fixed rate of ~37.5 samples per second.
+// A conversion is lost only if interrupts are disabled for longer than a conversion (1664 cycles),
+// it shows up as less than ~3.75 decimated samples per decisecond.
+#define AK_PH_OVERSAMPLING_BITS  4
+#define AK_PH_OVERSAMPLING_SAMPLES  (1 << (2 * AK_PH_OVERSAMPLING_BITS))
+
+// Oversampling only gives extra resolution if there is at least 1 LSB of noise in the signal.
+// If enabled, then a triangular dither waveform is generated on PH6 (OC2B) using Timer2.
+// The triangle makes exactly one period within a decimation window, so it averages out
+// in every decimated sample. PH6 must be connected to ADC0 through an RC network!
+// Keep it disabled if there is no such hardware, PH6 is then configured as unused pin.
+#define AK_PH_DITHER_ENABLED  0
+
+// Decimated PH samples are collected into batches that are closed every this number of deciseconds.
+// Closed batches are tagged with uptime and put into FIFO, usart0_writer sends one batch per status.
+// Writer must be able to send statuses faster than batches are produced in both status formats,
+// otherwise FIFO overflows and '~' capture chunks (they wait for an empty FIFO) are never sent.
+// At 9600 baud (960 bytes per second) a binary status is ~120 bytes (~8 per second), a text one
+// is ~190 bytes typically and ~300 at most (5..3 per second, text is the format after reset),
+// and time sync replies, events and trace lines share the line too. So we use 2 batches per second.
+#define AK_PH_BATCH_DECISECONDS  5
+
+// Number of closed batches waiting for usart0_writer. Must be power of 2!
+#define AK_PH_BATCH_FIFO_SIZE  8
+
+// PH is averaged over these windows on AVR, so host gets warm averages right after (re)start.
+// Per second means are kept in a ring buffer of AK_PH_WINDOW_LONG_SECONDS entries (2 bytes each).
+#define AK_PH_WINDOW_SHORT_SECONDS  60
+#define AK_PH_WINDOW_LONG_SECONDS  600
+
+// Capture of decimated PH samples around CO2 switching (step response of the probe).
+// Decimated samples come at 16Mhz / 128 / 13 / 256 = ~37.6 per second,
+// so we capture ~3.4 seconds before the switching and ~10.2 seconds after it.
+#define AK_CAPTURE_SAMPLES  512  // Must be power of 2!
+#define AK_CAPTURE_PRE_TRIGGER_SAMPLES  128
+
+// Captured samples are sent in lines of this number of samples
+#define AK_CAPTURE_CHUNK_SAMPLES  16
+
+// Temperature of aquarium water is used to compensate PH (Nernst equation).
+// If temperature is older than this, then we assume calibration temperature (no compensation).
+#define AK_PH_MAX_TEMPERATURE_AGE_DECISECONDS  200
+
+// On-MCU PH safety. If PH (as computed by AVR) is below the limit for the given number
+// of deciseconds in a row, then CO2 is locked out. Lockout is released when PH is
+// above the limit plus hysteresis for the same number of deciseconds in a row.
+// The limit and the hysteresis come with PH calibration (see PhCalibration), so it works
+// only if host has uploaded PH calibration.
+#define AK_PH_SAFETY_DECISECONDS  100
+
+// On-MCU CO2 controller (see 'CO2 curve'). PH must cross the curve (or the curve plus margin)
+// for this number of deciseconds in a row before the valve is switched.
+#define AK_CO2_CURVE_DECISECONDS  5
+
+// In Co2CurveFallback mode, AVR takes over if host doesn't send CO2 commands for this long
+#define AK_CO2_HOST_TIMEOUT_DECISECONDS  (2L * 60L * 10L)
+
 // - - - - - - - - - - - -  - - -
 // Here is what we are going to use for communication using USB/serial port
 // Frame format is 8N1 (8 bits, no parity, 1 stop bit)
@@ -44,12 +119,27 @@
 // Size of buffer for bytes we receive from USART0/USB.
 // RX-Interrupt puts bytes into the given ring buffer if there is space in it.
 // A thread takes byte from the buffer and process it.
-// Must be power of 2!
-#define AK_USART0_RX_BUF_SIZE  128
+// Must be 256: indexes are u8 and wrap by themselves (see USART0_RX_vect)!
+#define AK_USART0_RX_BUF_SIZE  256
+
+// Protocol version and codes of commands (generated by maintain-protocol from protocol.json)
+#include "protocol.h"
+
+// - - - - - - - - - - - -  - - -
+// Size of trace ring in bytes (records are written with '%' prefix into USART0, see 'Tracing').
+// Must be power of 2 and less than 256!
+#define AK_TRACE_BUF_SIZE     64
 
 // - - - - - - - - - - - -  - - -
-// Number of debug bytes (data is written with '>' prefix into USART0)
-#define AK_DEBUG_BUF_SIZE     64
+// Number of events kept in the event log (see 'Event log'). Must be power of 2 and less than 256!
+#define AK_EVENTS_SIZE  64
+
+// Events are sent in lines of up to this number of events
+#define AK_EVENTS_PER_LINE  8
+
+// - - - - - - - - - - - -  - - -
+// Maximum number of bytes (including CRC) host can upload using 'U' commands
+#define AK_UPLOAD_BUF_SIZE    32
 
 // - - - - - - - - - - - -  - - -
 // Protection
@@ -68,12 +158,78 @@
 // will cause light changes... so we delay it until it doesn't cause it
 #define AK_MAX_HARDLIMIT_CLOCK_DRIFT_DECISECONDS  20
 
+// State that raspberry pi CO2-controlling algorithm wants to set is reset after this timeout.
+// It's expected that rpi-controller confirms the state every minute,
+// but we tolerate restart of the rpi-controller within 15 minutes.
+#define AK_REQUIRED_CO2_SWITCH_STATE_TIMEOUT_DECISECONDS  (15 * 60 * 10)
+
+// Forced light / CO2 states are reset after this timeout
+#define AK_FORCE_TIMEOUT_DECISECONDS  (10 * 60 * 10)
+
+// Light and CO2 outputs must be confirmed at least this often or they're switched off,
+// see 'rearm_safe_output_timer'
+#define AK_SAFE_OUTPUT_CHECK_DECISECONDS  50
+
+// - - - - - - - - - - - -  - - -
+// Light dimming
+
+// Duration of sunrise / sunset ramp at the start / end of light interval of the schedule
+#define AK_LIGHT_RAMP_DECISECONDS  (30L * 60L * 10L)
+
+// Ramp profiles of dimmers, see DimmerRamp
+#define AK_DAY_LIGHT_RAMP  GammaRamp
+#define AK_NIGHT_LIGHT_RAMP  LinearRamp
+
+// TOP of Timer4 (10 bits): 16Mhz / 1024 = 15.6kHz, that's beyond audible range
+#define AK_DIMMER_PWM_TOP  1023
+
+// - - - - - - - - - - - -  - - -
+// Clock trimming
+
+// Timer1 compare value that gives one decisecond with nominal X_CPU$ frequency
+// (16MHz / prescaler 64 / 25000), this is what AKAT configures for X_EVERY_DECISECOND$
+#define AK_TIMER1_NOMINAL_TOP  24999
+
+// One Timer1 tick per decisecond is 40 ppm (i.e. 320 in 1/8 ppm)
+#define AK_CLOCK_TRIM_PPM_X8_PER_TICK  320
+
+// Maximum learned crystal error (1/8 ppm)
+#define AK_CLOCK_TRIM_MAX_PPM_X8  (4000 * 8)
+
+// Drift samples that are larger than this are ignored by estimation
+#define AK_CLOCK_TRIM_MAX_SAMPLE_DRIFT_DECISECONDS  600
+
+// Hourly window is ignored if it has less samples than this
+#define AK_CLOCK_TRIM_MIN_WINDOW_SAMPLES  60
+
+// Maximum change of drift within an hour used by estimation (1/16 decisecond), ~4000 ppm
+#define AK_CLOCK_TRIM_MAX_HOURLY_DELTA_X16  2300
+
+// Only this part of the measured residual error is applied every hour
+#define AK_CLOCK_TRIM_GAIN_DIVISOR  4
+
+// Timer1 ticks in 1/16 of decisecond (25000 / 16)
+#define AK_CLOCK_TRIM_TICKS_PER_X16  1563
+
+// - - - - - - - - - - - -  - - -
+// Time sync
+
+// Unit of phase adjustment requested by host with 'P' command, in Timer1 ticks (~0.4ms).
+// Argument is signed: 1..127 makes the next period longer, 129..255 (i.e. -127..-1) makes it shorter.
+#define AK_TIME_SYNC_PHASE_TICKS_PER_UNIT  98
+
+// Period is never made shorter than this number of ticks ahead of Timer1 counter
+#define AK_TIME_SYNC_PHASE_MIN_TICKS_AHEAD  1000
+
 // - - - - - - - - - - - -  - - -
 // Misc
 
 // Number of deciseconds in a day
 #define AK_NUMBER_DECISECONDS_IN_DAY  (24L * 60L * 60L * 10L)
 
+// 273.15 * 16, used to convert temperatureX16 from celsius to kelvin
+#define AK_ZERO_CELSIUS_IN_KELVIN_X16  4370
+
 // Default time controller starts with.
 // This is used to avoid situation when reset happens
 // and Raspberry PI or other controller are unable to provide
@@ -98,6 +254,9 @@ static const char HEX[16] = "0123456789abcdef";
 // Must be the same enum as the enum in typescript with the same name
 typedef enum {NotForced = 0, Day = 1, Night = 2} LightForceMode;
 
+// Must be the same enum as the enum in typescript with the same name, see 'CO2 curve'
+typedef enum {Co2CurveDisabled = 0, Co2CurveFallback = 1, Co2CurveContinuous = 2} Co2CurveMode;
+
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
@@ -120,10 +279,10 @@ X_UNUSED_PIN$(E7); // 9    PE7 ( CLKO/ICP3/INT7 )
 X_UNUSED_PIN$(H0); // 12   PH0 ( RXD2 ) Digital pin 17 (RX2)
 X_UNUSED_PIN$(H1); // 13   PH1 ( TXD2 ) Digital pin 16 (TX2)
 X_UNUSED_PIN$(H2); // 14   PH2 ( XCK2 )
-X_UNUSED_PIN$(H3); // 15   PH3 ( OC4A ) Digital pin 6 (PWM)
-X_UNUSED_PIN$(H4); // 16   PH4 ( OC4B ) Digital pin 7 (PWM)
+// Main light dimmer  15   PH3 ( OC4A ) Digital pin 6 (PWM)
+// Night light dimmer 16   PH4 ( OC4B ) Digital pin 7 (PWM)
 X_UNUSED_PIN$(H5); // 17   PH5 ( OC4C ) Digital pin 8 (PWM)
-X_UNUSED_PIN$(H6); // 18   PH6 ( OC2B ) Digital pin 9 (PWM)
+// PH dither ........ 18   PH6 ( OC2B ) Digital pin 9 (PWM), see AK_PH_DITHER_ENABLED
 X_UNUSED_PIN$(B0); // 19   PB0 ( SS/PCINT0 ) Digital pin 53 (SS)
 X_UNUSED_PIN$(B1); // 20   PB1 ( SCK/PCINT1 ) Digital pin 52 (SCK)
 X_UNUSED_PIN$(B2); // 21   PB2 ( MOSI/PCINT2 ) Digital pin 51 (MOSI)
@@ -215,33 +374,95 @@ X_UNUSED_PIN$(F1); // 96   PF1 ( ADC1 ) Analog pin 1
 // Timers
 
 // 16-bit Timer1 is used for 'X_EVERY_DECISECOND$'
+// 8-bit Timer2 is used for PH dither (if AK_PH_DITHER_ENABLED)
+
+GLOBAL$() {
+    // Number of Timer1 periods (deciseconds) since start, used for time sync stamps.
+    // Unlike uptime_deciseconds it's incremented by the very first X_EVERY_DECISECOND$ handler.
+    STATIC_VAR$(volatile u32 timer1_periods);
+}
+
+X_EVERY_DECISECOND$(timer1_periods_ticker) {
+    timer1_periods += 1;
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
-// Support for simple debugging
+// Tracing
+
+// Tracepoints are declared in protocol.json, maintain-protocol generates a TRACE_<NAME>(args) macro
+// for each of them. A record is: u8 tracepoint id, u16 timer1_periods (low bits), u8 number of records
+// of the tracepoint dropped since the previous one, args. Records go into a ring and usart0_writer
+// sends everything from the ring as one binary '%' line.
+//
+// A record is dropped (and counted) if the tracepoint fired sooner than minIntervalDeciseconds after
+// the previous record or if there is no space in the ring. Tracing is not for ISRs: X_EVERY_DECISECOND$
+// handlers and threads only.
 
 GLOBAL$() {
-    // Make volatile so we can use it from ISR (in theory)
-    STATIC_VAR$(volatile u8 debug_bytes_buf[AK_DEBUG_BUF_SIZE], initial = {});
-    STATIC_VAR$(volatile u8 debug_next_empty_idx);
-    STATIC_VAR$(volatile u8 debug_next_read_idx);
-    STATIC_VAR$(volatile u8 debug_overflow_count);
+    STATIC_VAR$(u8 trace_buf[AK_TRACE_BUF_SIZE], initial = {});
+    STATIC_VAR$(u8 trace_next_empty_idx);
+    STATIC_VAR$(u8 trace_next_read_idx);
+
+    // Where the record being written goes, it's committed by trace_end
+    STATIC_VAR$(u8 trace_write_idx);
+
+    STATIC_VAR$(u32 trace_next_allowed_periods[AK_TRACEPOINTS], initial = {});
+    STATIC_VAR$(u8 trace_drops[AK_TRACEPOINTS], initial = {});
+
+    // Total number of dropped records (saturated), it's in status
+    STATIC_VAR$(u8 trace_drop_count);
+}
+
+FUNCTION$(void trace_put_u8(const u8 b), unused) {
+    trace_buf[trace_write_idx] = b;
+    trace_write_idx = (trace_write_idx + AKAT_ONE) & (AK_TRACE_BUF_SIZE - 1);
+}
+
+FUNCTION$(void trace_put_u16(const u16 v), unused) {
+    trace_put_u8((u8)v);
+    trace_put_u8((u8)(v >> 8));
 }
 
-FUNCTION$(void add_debug_byte(const u8 b), unused) {
-    u8 new_next_empty_idx = (debug_next_empty_idx + AKAT_ONE) & (AK_DEBUG_BUF_SIZE - 1);
-    if (new_next_empty_idx == debug_next_read_idx) {
-        debug_overflow_count += AKAT_ONE;
+FUNCTION$(void trace_put_u32(const u32 v), unused) {
+    trace_put_u16((u16)v);
+    trace_put_u16((u16)(v >> 16));
+}
+
+FUNCTION$(void trace_end(), unused) {
+    trace_next_empty_idx = trace_write_idx;
+}
+
+// Returns true if the record must be written (with trace_put_* and trace_end)
+FUNCTION$(u8 trace_begin(const u8 id, const u8 args_size, const u16 min_interval_deciseconds), unused) {
+    const u8 idx = id - 1;
+    const u8 used = (trace_next_empty_idx - trace_next_read_idx) & (AK_TRACE_BUF_SIZE - 1);
+
+    // One byte of the ring is never used, otherwise full ring would look empty
+    if ((i32)(timer1_periods - trace_next_allowed_periods[idx]) < 0 || used + 4 + args_size >= AK_TRACE_BUF_SIZE) {
+        trace_drops[idx] += AKAT_ONE;
+        trace_drop_count += AKAT_ONE;
+
         // Don't let it overflow!
-        if (!debug_overflow_count) {
-            debug_overflow_count -= AKAT_ONE;
+        if (!trace_drops[idx]) {
+            trace_drops[idx] -= AKAT_ONE;
         }
-    } else {
-        debug_bytes_buf[debug_next_empty_idx] = b;
-        debug_next_empty_idx = new_next_empty_idx;
+        if (!trace_drop_count) {
+            trace_drop_count -= AKAT_ONE;
+        }
+        return 0;
     }
+
+    trace_next_allowed_periods[idx] = timer1_periods + min_interval_deciseconds;
+
+    trace_write_idx = trace_next_empty_idx;
+    trace_put_u8(id);
+    trace_put_u16((u16)timer1_periods);
+    trace_put_u8(trace_drops[idx]);
+    trace_drops[idx] = 0;
+    return 1;
 }
 
 
@@ -249,351 +470,2567 @@ FUNCTION$(void add_debug_byte(const u8 b), unused) {
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
-// Performance counter
-
-// Measure how many iteration we are able to perform between decisecond ticks
-// We use internal counter which we increment in every iteration of main loop
-// and then we copy the counter to main_loop_iterations_in_last_decisecond
-// every decisecond and reset the internal counter.
-// Lowe the value in main_loop_iterations_in_last_decisecond, busyier the loop!
+// Event log
+
+// Ring of (tick, code, arg) records of switching and protection events. Tick is timer1_periods,
+// so host converts it into its own time using time sync. Every event gets a sequence number (u8),
+// host sends the sequence number of the next event it wants with 'E' command and usart0_writer
+// replies with up to AK_EVENTS_PER_LINE events starting from it (or from the oldest event we have
+// if it's already overwritten). Status has the sequence number of the next event to be logged,
+// so host asks only when there is something new.
+
+typedef enum {
+    EventStartup = 1,               // Arg is mcusr_at_startup | (warm_restarted << 8)
+    EventDayLightSwitched = 2,      // Arg is the new state
+    EventNightLightSwitched = 3,    // Arg is the new state
+    EventCo2Switched = 4,           // Arg is the new state
+    EventSafeOutputOff = 5,         // Output wasn't touched in time, arg is its TimerId
+    EventLightForced = 6,           // Arg is LightForceMode
+    EventCo2ForcedOff = 7,
+    EventForceExpired = 8,          // Arg is TimerId of the force
+    EventProtectionRejected = 9,    // Arg is ProtectionRejection
+    EventClockCorrected = 10        // Arg is i16 drift in deciseconds (saturated)
+} EventCode;
+
+typedef enum {LightForceRejected = 1, ScheduleProfileRejected = 2, ClockCorrectionRejected = 3} ProtectionRejection;
+
+typedef struct {
+    u32 tick;
+    u8 code;
+    u16 arg;
+} Event;
 
 GLOBAL$() {
-    STATIC_VAR$(u32 __current_main_loop_iterations);
-    STATIC_VAR$(u32 main_loop_iterations_in_last_decisecond);
+    STATIC_VAR$(Event events[AK_EVENTS_SIZE], initial = {});
+    STATIC_VAR$(u8 events_next_seq);
+    STATIC_VAR$(u8 events_count);
+
+    // Set by 'E' command, reset by usart0_writer once it replies
+    STATIC_VAR$(u8 events_requested);
+    STATIC_VAR$(u8 events_requested_seq);
 }
 
-RUNNABLE$(performance_runnable) {
-    __current_main_loop_iterations += 1;
+FUNCTION$(void log_event(const u8 code, const u16 arg)) {
+    Event *e = &events[events_next_seq & (AK_EVENTS_SIZE - 1)];
+    e->tick = timer1_periods;
+    e->code = code;
+    e->arg = arg;
+
+    events_next_seq += AKAT_ONE;
+    if (events_count < AK_EVENTS_SIZE) {
+        events_count += AKAT_ONE;
+    }
 }
 
-X_EVERY_DECISECOND$(performance_ticker) {
-    main_loop_iterations_in_last_decisecond = __current_main_loop_iterations;
-    __current_main_loop_iterations = 0;
+// Returns the given sequence number if the event is still in the ring, otherwise the oldest one
+FUNCTION$(u8 get_available_event_seq(const u8 seq)) {
+    const u8 behind = events_next_seq - seq;
+    return behind <= events_count ? seq : (u8)(events_next_seq - events_count);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
-// Control
-
-X_GPIO_SAFE_OUTPUT$(day_light_switch, A4, safe_state = 0, state_timeout_deciseconds = 100);
-X_GPIO_SAFE_OUTPUT$(night_light_switch, A5, safe_state = 0, state_timeout_deciseconds = 100);
-X_GPIO_SAFE_OUTPUT$(co2_switch, A6, safe_state = 0, state_timeout_deciseconds = 100);
+// Timer wheel
+
+// Hierarchical timer wheel shared by timed flags and safe outputs.
+// Level 0 has a slot per decisecond of the current second, level 1 has a slot per second
+// of the current minute and level 2 has a slot per minute of the current hour.
+// Timer is linked into a slot of the lowest level that covers its expiration time,
+// when a second (minute) starts, timers of the corresponding level 1 (level 2) slot are moved down.
+// This way ticker only touches timers that are about to expire, no matter how many timers are armed.
+// Timeouts are limited to AK_TIMER_MAX_DECISECONDS (59 minutes) so that minute slot is not ambiguous.
+
+#define AK_TIMER_NONE 255
+#define AK_TIMER_MAX_DECISECONDS (59 * 60 * 10)
+#define AK_TIMER_WHEEL_SECOND_SLOTS_OFFSET 10
+#define AK_TIMER_WHEEL_MINUTE_SLOTS_OFFSET (10 + 60)
+#define AK_TIMER_WHEEL_SLOTS_COUNT (10 + 60 + 60)
+
+typedef enum {
+    // Timed flags, flag is set while its timer is armed (must go first, see AK_WARM_STATE_TIMED_FLAGS)
+    RequiredCo2SwitchStateTimer = 0,
+    DayLightForcedTimer,
+    NightLightForcedTimer,
+    Co2ForceOffTimer,
+
+    // Safe outputs, see 'rearm_safe_output_timer'
+    DayLightSwitchTimer,
+    NightLightSwitchTimer,
+    Co2SwitchTimer,
+    DayLightDimmerTimer,
+    NightLightDimmerTimer,
+
+    // Armed while host sends CO2 commands, see AK_CO2_HOST_TIMEOUT_DECISECONDS
+    Co2HostCommandsTimer,
+
+    TimersCount
+} TimerId;
+
+typedef struct {
+    void (*callback)();  // Called when timer expires (timer is already disarmed by then), can be NULL
+    u8 slot;             // Slot the timer is linked into or AK_TIMER_NONE if timer is not armed
+    u8 next;             // Next timer in the same slot or AK_TIMER_NONE
+    u8 prev;             // Previous timer in the same slot or AK_TIMER_NONE
+    u8 touched;          // Used by safe outputs only
+    u8 expires_decisecond;
+    u8 expires_second;
+    u8 expires_minute;
+} Timer;
 
 GLOBAL$() {
-    // Clock used to calculate state
-    STATIC_VAR$(u24 clock_deciseconds_since_midnight,
-                initial = AK_NUMBER_OF_CLOCK_DECISECONDS_AT_STARTUP);
-
-    // Last calculated drift of our clock comapred to data we got from server
-    // This one is signed integer!
-    STATIC_VAR$(i24 last_drift_of_clock_deciseconds_since_midnight,
-                initial = 0);
-
-    // Protects against spam / malfunction / misuse
-    STATIC_VAR$(u8 light_forces_since_protection_stat_reset);
-    STATIC_VAR$(u8 clock_corrections_since_protection_stat_reset);
-
-    // These variables indicate correction stuff received from raspberry-pi (i.e. via USB)
-    STATIC_VAR$(u8 received_clock0); // LSByte
-    STATIC_VAR$(u8 received_clock1);
-    STATIC_VAR$(u8 received_clock2, initial = 255); // MSByte. 255 means nothing is received
-
-    // CO2 protection - - -
-    STATIC_VAR$(u24 co2_deciseconds_until_can_turn_on,
-                initial = AK_CO2_OFF_MINUTES_BEFORE_UNLOCKED * 60L * 10L);
-
-    // Whether it's day or not as calculated by AVR's internal algorithm and interval
-    STATIC_VAR$(u8 co2_calculated_day, initial = 0);
-
-    // Current day-mode (either normal or alternative).
-    STATIC_VAR$(u8 alternative_day_enabled, initial = 0);
+    STATIC_VAR$(Timer timers[TimersCount], initial = {});
+    STATIC_VAR$(u8 timer_wheel_slots[AK_TIMER_WHEEL_SLOTS_COUNT], initial = {});
+    STATIC_VAR$(u8 timer_wheel_decisecond);
+    STATIC_VAR$(u8 timer_wheel_second);
+    STATIC_VAR$(u8 timer_wheel_minute);
 }
 
-// State that raspberry pi CO2-controlling algorithm wants to set.
-// It's expected that rpi-controller confirms the state every minute.
-// But we tolerate restart of the rpi-controller within 15 minutes.
-X_FLAG_WITH_TIMEOUT$(required_co2_switch_state, timeout = 15, unit = minutes);
+X_INIT$(timer_wheel_init) {
+    for (u8 i = 0; i < AK_TIMER_WHEEL_SLOTS_COUNT; i++) {
+        timer_wheel_slots[i] = AK_TIMER_NONE;
+    }
 
-// Forced states
-X_FLAG_WITH_TIMEOUT$(day_light_forced, timeout = 10, unit = minutes);
-X_FLAG_WITH_TIMEOUT$(night_light_forced, timeout = 10, unit = minutes);
-X_FLAG_WITH_TIMEOUT$(co2_force_off, timeout = 10, unit = minutes);
+    for (u8 i = 0; i < TimersCount; i++) {
+        timers[i].slot = AK_TIMER_NONE;
+    }
+}
 
-X_EVERY_HOUR$(reset_protection_stats) {
-    light_forces_since_protection_stat_reset = 0;
-    clock_corrections_since_protection_stat_reset = 0;
+FUNCTION$(u8 is_timer_armed(const u8 timer)) {
+    return timers[timer].slot != AK_TIMER_NONE;
 }
 
-// Called from uart-command-receiver if force-light command is received from raspberry-pi
-// Note that if we force something, then it will be automatically reset by
-// X_FLAG_WITH_TIMEOUT after some interval. See above.
-FUNCTION$(void force_light(const LightForceMode mode)) {
-    if (mode == NotForced) {
-        day_light_forced.set(0);
-        night_light_forced.set(0);
+FUNCTION$(void disarm_timer(const u8 timer)) {
+    Timer *t = &timers[timer];
+    if (t->slot == AK_TIMER_NONE) {
         return;
     }
 
-    if (light_forces_since_protection_stat_reset >= AK_MAX_LIGHT_FORCES_WITHIN_ONE_HOUR) {
-        return;
+    if (t->prev == AK_TIMER_NONE) {
+        timer_wheel_slots[t->slot] = t->next;
+    } else {
+        timers[t->prev].next = t->next;
     }
 
-    if (mode == Day) {
-        day_light_forced.set(1);
-        night_light_forced.set(0);
-    } else {
-        day_light_forced.set(0);
-        night_light_forced.set(1);
+    if (t->next != AK_TIMER_NONE) {
+        timers[t->next].prev = t->prev;
     }
 
-    light_forces_since_protection_stat_reset += 1;
+    t->slot = AK_TIMER_NONE;
 }
 
-// Called from uart-command-receiver if set-co2 switch command is received from raspberry-pi
-FUNCTION$(void update_co2_switch_state(const u8 new_state)) {
-    required_co2_switch_state.set(new_state);
-}
+// Links already disarmed timer into a slot according to its expiration time.
+// Expiration time must be within the current hour (i.e. less than an hour ahead).
+FUNCTION$(void link_timer(const u8 timer)) {
+    Timer *t = &timers[timer];
 
-// Called from uart-command-receiver if set-alt-day command is received from raspberry-pi
-// We use force light protection to avoid misuse or bugs
-FUNCTION$(void set_alt_day(const u8 enabled)) {
-    if (enabled == alternative_day_enabled) {
-        return;
+    u8 slot;
+    if (t->expires_minute != timer_wheel_minute) {
+        slot = AK_TIMER_WHEEL_MINUTE_SLOTS_OFFSET + t->expires_minute;
+    } else if (t->expires_second != timer_wheel_second) {
+        slot = AK_TIMER_WHEEL_SECOND_SLOTS_OFFSET + t->expires_second;
+    } else {
+        slot = t->expires_decisecond;
     }
 
-    if (light_forces_since_protection_stat_reset >= AK_MAX_LIGHT_FORCES_WITHIN_ONE_HOUR) {
-        return;
+    t->slot = slot;
+    t->prev = AK_TIMER_NONE;
+    t->next = timer_wheel_slots[slot];
+    if (t->next != AK_TIMER_NONE) {
+        timers[t->next].prev = timer;
     }
-
-    alternative_day_enabled = enabled ? AKAT_ONE : 0;
-    light_forces_since_protection_stat_reset += 1;
+    timer_wheel_slots[slot] = timer;
 }
 
-// - - - - - - - - - - - -  - - - - - - - ---- - - -- - - - -  - - - -
-// - - - - - - - - - - - -  - - - - - - - ---- - - -- - - - -  - - - -
-// - - - - - - - - - - - -  - - - - - - - ---- - - -- - - - -  - - - -
-// Main function that performs state switching
+// (Re)arms timer so that it expires after given number of deciseconds
+FUNCTION$(void arm_timer(const u8 timer, const u16 timeout_deciseconds)) {
+    disarm_timer(timer);
 
-FUNCTION$(u8 is_day(const u24 deciseconds_since_midnight)) {
-    if (day_light_forced.is_set()) {
-        return AKAT_ONE;
+    u16 deciseconds = timeout_deciseconds;
+    if (!deciseconds) {
+        deciseconds = 1;
+    } else if (deciseconds > AK_TIMER_MAX_DECISECONDS) {
+        deciseconds = AK_TIMER_MAX_DECISECONDS;
     }
 
-    if (night_light_forced.is_set()) {
-        return 0;
+    // Division is not cheap on AVR, but timers are armed rarely
+    u16 seconds = deciseconds / 10;
+    u8 decisecond = timer_wheel_decisecond + (u8)(deciseconds - seconds * 10);
+    if (decisecond >= 10) {
+        decisecond -= 10;
+        seconds += 1;
     }
 
-    if (alternative_day_enabled) {
-        // Is nap time withing alternative day?
-        if ((deciseconds_since_midnight >= (AK_ALT_DAY_NAP_START_HOUR * 60L * 60L * 10L)) && (deciseconds_since_midnight < (AK_ALT_DAY_NAP_END_HOUR * 60L * 60L * 10L))) {
-            return 0;
-        }
-
-        return (deciseconds_since_midnight >= (AK_ALT_DAY_START_HOUR * 60L * 60L * 10L)) && (deciseconds_since_midnight < (AK_ALT_DAY_END_HOUR * 60L * 60L * 10L));
-    } else {
-        return (deciseconds_since_midnight >= (AK_NORM_DAY_START_HOUR * 60L * 60L * 10L)) && (deciseconds_since_midnight < (AK_NORM_DAY_END_HOUR * 60L * 60L * 10L));
+    u8 minutes = (u8)(seconds / 60);
+    u8 second = timer_wheel_second + (u8)(seconds - minutes * (u16)60);
+    if (second >= 60) {
+        second -= 60;
+        minutes += 1;
     }
-}
 
-X_EVERY_DECISECOND$(controller_tick) {
-    // - - - - - - - - - - - - - - - -  CLOCK CORRECTION - - - - - -
-    u24 new_clock_deciseconds_since_midnight = clock_deciseconds_since_midnight + 1;
-    if (new_clock_deciseconds_since_midnight >= AK_NUMBER_DECISECONDS_IN_DAY) {
-        new_clock_deciseconds_since_midnight = 0;
+    u8 minute = timer_wheel_minute + minutes;
+    if (minute >= 60) {
+        minute -= 60;
     }
 
-    u8 new_calculated_day_light_state = is_day(new_clock_deciseconds_since_midnight);
-
-    if (received_clock2 != 255) {
-        u24 received_clock = (((u24)received_clock2) << 16) + (((u24)received_clock1) << 8) + received_clock0;
+    Timer *t = &timers[timer];
+    t->expires_decisecond = decisecond;
+    t->expires_second = second;
+    t->expires_minute = minute;
+    link_timer(timer);
+}
 
-        last_drift_of_clock_deciseconds_since_midnight = (i24)received_clock - (i24)clock_deciseconds_since_midnight;
+// Moves all timers from the given slot to lower levels or to the current decisecond slot
+FUNCTION$(void cascade_timer_wheel_slot(const u8 slot)) {
+    u8 timer = timer_wheel_slots[slot];
+    timer_wheel_slots[slot] = AK_TIMER_NONE;
 
-        // Perform correction if drift is large than a limit
-        if (clock_corrections_since_protection_stat_reset < AK_MAX_CLOCK_CORRECTIONS_WITHIN_ONE_HOUR) {
-            if ((last_drift_of_clock_deciseconds_since_midnight >= AK_MAX_CLOCK_DRIFT_DECISECONDS) || (last_drift_of_clock_deciseconds_since_midnight <= -AK_MAX_CLOCK_DRIFT_DECISECONDS)) {
-                // Perform correction if correction doesn't affect light state..
-                // or if we can't delay correction any longer.
-                const u8 corrected_calculated_day_light_state = is_day(new_clock_deciseconds_since_midnight);
-                if ((corrected_calculated_day_light_state == new_calculated_day_light_state)
-                        || (last_drift_of_clock_deciseconds_since_midnight >= AK_MAX_HARDLIMIT_CLOCK_DRIFT_DECISECONDS)
-                        || (last_drift_of_clock_deciseconds_since_midnight <= -AK_MAX_HARDLIMIT_CLOCK_DRIFT_DECISECONDS)) {
-                    // Perform correction...
-                    clock_corrections_since_protection_stat_reset += 1;
-                    new_clock_deciseconds_since_midnight = received_clock;
-                    new_calculated_day_light_state = corrected_calculated_day_light_state;
-                }
-            }
-        }
+    while (timer != AK_TIMER_NONE) {
+        const u8 next = timers[timer].next;
+        link_timer(timer);
+        timer = next;
     }
+}
 
-    // We either have handled clock correction or ignored it.
-    // Anyway, invalidate current correction data
-    received_clock2 = 255;
+X_EVERY_DECISECOND$(timer_wheel_ticker) {
+    timer_wheel_decisecond += AKAT_ONE;
+    if (timer_wheel_decisecond >= 10) {
+        timer_wheel_decisecond = 0;
+        timer_wheel_second += AKAT_ONE;
 
-    // Finally set clock to new clock value, either corrected or normal one
-    clock_deciseconds_since_midnight = new_clock_deciseconds_since_midnight;
+        if (timer_wheel_second >= 60) {
+            timer_wheel_second = 0;
+            timer_wheel_minute += AKAT_ONE;
 
-    // - - - - - - - - - - - - - - - -  CO2 - - - - - -
+            if (timer_wheel_minute >= 60) {
+                timer_wheel_minute = 0;
+            }
 
-    // New CO2 state if by default OFF
-    u8 new_co2_state = 0;
+            cascade_timer_wheel_slot(AK_TIMER_WHEEL_MINUTE_SLOTS_OFFSET + timer_wheel_minute);
+        }
 
-    // Calculate day so it can be used also used for debugging
-    if (alternative_day_enabled) {
-        co2_calculated_day =
-            (clock_deciseconds_since_midnight >= ((AK_ALT_DAY_START_HOUR - AK_CO2_DAY_PRE_START_HOURS) * 60L * 60L * 10L))
-                && (clock_deciseconds_since_midnight < (AK_ALT_DAY_END_HOUR * 60L * 60L * 10L));
-    } else {
-        co2_calculated_day =
-            (clock_deciseconds_since_midnight >= ((AK_NORM_DAY_START_HOUR - AK_CO2_DAY_PRE_START_HOURS) * 60L * 60L * 10L))
-                && (clock_deciseconds_since_midnight < (AK_NORM_DAY_END_HOUR * 60L * 60L * 10L));
+        cascade_timer_wheel_slot(AK_TIMER_WHEEL_SECOND_SLOTS_OFFSET + timer_wheel_second);
     }
 
-    if (co2_deciseconds_until_can_turn_on) {
-        // We can't feed CO2, because we can't yet... (it was turned off recently)
-        co2_deciseconds_until_can_turn_on -= 1;
-    } else {
-        if (required_co2_switch_state.is_set()) {
-            // New state will be whether it's in co2 day or not
-            new_co2_state = co2_calculated_day && !co2_force_off.is_set();
+    // Callback may arm or disarm any timer, including ones expiring in this slot, so the slot is re-read
+    // after every callback. Armed timer expires at least a decisecond later, so it never lands here again.
+    u8 timer;
+    while ((timer = timer_wheel_slots[timer_wheel_decisecond]) != AK_TIMER_NONE) {
+        disarm_timer(timer);
+        Timer *t = &timers[timer];
+        if (t->callback) {
+            t->callback();
         }
     }
+}
 
-    // - - - - - - - - - - - - - - - -  STATE CHANGING - - - - - -
-
-    // Light
-    if (new_calculated_day_light_state) {
-        // DAY
-        day_light_switch.set(AKAT_ONE);
-        night_light_switch.set(0);
+// Timed flag is set while its timer is armed, so it's automatically reset after timeout
+FUNCTION$(void set_timed_flag(const u8 timer, const u8 state, const u16 timeout_deciseconds)) {
+    if (state) {
+        arm_timer(timer, timeout_deciseconds);
     } else {
-        // NIGHT
-        day_light_switch.set(0);
+        disarm_timer(timer);
+    }
+}
 
-        if (alternative_day_enabled) {
-            // No night light during night when alternative mode is enabled
-            night_light_switch.set(0);
-        } else {
-            // Enable night light because it's night
-            night_light_switch.set(AKAT_ONE);
-        }
+// Safe output must be touched (i.e. set) at least once per AK_SAFE_OUTPUT_CHECK_DECISECONDS,
+// otherwise it's switched to the safe state. Output timer is periodic and is never disarmed,
+// so if the output is not touched between two checks, it's switched to the safe state
+// at most 2 * AK_SAFE_OUTPUT_CHECK_DECISECONDS after the last touch.
+// Returns whether output was touched since the last check.
+FUNCTION$(u8 rearm_safe_output_timer(const u8 timer)) {
+    const u8 touched = timers[timer].touched;
+    timers[timer].touched = 0;
+    arm_timer(timer, AK_SAFE_OUTPUT_CHECK_DECISECONDS);
+    return touched;
+}
+
+// Returns number of deciseconds until the timer expires or zero if it's not armed
+FUNCTION$(u16 get_timer_remaining_deciseconds(const u8 timer)) {
+    const Timer *t = &timers[timer];
+    if (t->slot == AK_TIMER_NONE) {
+        return 0;
     }
 
-    // CO2
-    if (co2_switch.is_set() && !new_co2_state) {
-        // We are turning CO2 off...
-        // Lock co2 switch so it can't be turned on too soon
-        co2_deciseconds_until_can_turn_on = AK_CO2_OFF_MINUTES_BEFORE_UNLOCKED * 60L * 10L;
+    u8 minutes = t->expires_minute + 60 - timer_wheel_minute;
+    if (minutes >= 60) {
+        minutes -= 60;
     }
-    co2_switch.set(new_co2_state);
-}
 
-////////////////////////////////////////////////////////////////////////////////
-////////////////////////////////////////////////////////////////////////////////
-////////////////////////////////////////////////////////////////////////////////
-////////////////////////////////////////////////////////////////////////////////
-// Uptime
+    // Might be negative, but the total is always positive
+    const i16 deciseconds = ((i16)t->expires_second - (i16)timer_wheel_second) * 10
+                            + ((i16)t->expires_decisecond - (i16)timer_wheel_decisecond);
 
-GLOBAL$() {
-    STATIC_VAR$(u32 uptime_deciseconds);
+    return (u16)minutes * 600 + (u16)deciseconds;
 }
 
-X_EVERY_DECISECOND$(uptime_ticker) {
-    uptime_deciseconds += 1;
+FUNCTION$(void touch_safe_output_timer(const u8 timer)) {
+    timers[timer].touched = AKAT_ONE;
 }
 
+
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
-// Led pins
+// Uploads
 
-X_GPIO_OUTPUT$(blue_led, B7);
+// Host uploads multi-byte data (like PH calibration) one byte per 'U' command
+// and then commits it with 'V' command where argument is an upload target.
+// The last uploaded byte must be CRC of all the previous bytes.
+// Buffer is reset on every commit, no matter whether it's successful or not.
 
+// Must be the same enum as the enum in typescript with the same name
+typedef enum {PhCalibrationUpload = 1, ScheduleProfileUpload = 2, Co2CurveUpload = 3, Co2nnConfigUpload = 4} UploadTarget;
 
-////////////////////////////////////////////////////////////////////////////////
-////////////////////////////////////////////////////////////////////////////////
-////////////////////////////////////////////////////////////////////////////////
-////////////////////////////////////////////////////////////////////////////////
-// Watchdog
+GLOBAL$() {
+    STATIC_VAR$(u8 upload_buf[AK_UPLOAD_BUF_SIZE], initial = {});
+    STATIC_VAR$(u8 upload_size);
+    STATIC_VAR$(u8 upload_errors);
+}
 
-X_WATCHDOG$(8s);
+// Called from uart-command-receiver if 'U' command is received
+FUNCTION$(void upload_byte(const u8 b)) {
+    if (upload_size < AK_UPLOAD_BUF_SIZE) {
+        upload_buf[upload_size] = b;
+    }
 
-////////////////////////////////////////////////////////////////////////////////
-////////////////////////////////////////////////////////////////////////////////
-////////////////////////////////////////////////////////////////////////////////
-////////////////////////////////////////////////////////////////////////////////
-// Activity indication
+    // Keep counting beyond the buffer size, so the commit fails if too much is uploaded
+    if (upload_size != 255) {
+        upload_size += AKAT_ONE;
+    }
+}
 
-// This piece of code will be executed in akat event/thread loop every 1/10 second.
-// We use to turn the blue led ON and OFF
-X_EVERY_DECISECOND$(activity_led) {
-    STATIC_VAR$(u8 state);
+// Returns true if upload buffer contains exactly 'size' bytes followed by their CRC
+FUNCTION$(u8 is_valid_upload(const u8 size)) {
+    if (size >= AK_UPLOAD_BUF_SIZE || upload_size != size + 1) {
+        return 0;
+    }
 
-    blue_led.set(state);
-    state = !state;
+    return akat_crc_add_bytes(0, upload_buf, size) == upload_buf[size];
 }
 
+FUNCTION$(void count_upload_error(const u8 target)) {
+    TRACE_UPLOAD_REJECTED(target, upload_size);
 
-////////////////////////////////////////////////////////////////////////////////
-////////////////////////////////////////////////////////////////////////////////
-////////////////////////////////////////////////////////////////////////////////
-////////////////////////////////////////////////////////////////////////////////
-// DS18B20
+    upload_errors += AKAT_ONE;
+    // Don't let it overflow!
+    if (!upload_errors) {
+        upload_errors -= AKAT_ONE;
+    }
+}
 
-X_DS18B20$(ds18b20_aqua, A0);
-X_DS18B20$(ds18b20_case, A1);
 
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
-// ADC
+// Capture
 
-X_INIT$(init_adc) {
-    // We just use default ADC channel (ADC0 marked as 'A0' on the PCB)
-    // No need to change or setup that. But we must select reference voltage for ADC.
-    // We use AVCC which is connected to VCC on the board.
-    ADMUX = H(REFS0);
+// Host arms capture with 'R' command. While armed, decimated samples are recorded
+// into a ring buffer. When controller_tick switches CO2, we record samples until
+// the buffer contains AK_CAPTURE_PRE_TRIGGER_SAMPLES samples before the switching
+// and the rest after. Then usart0_writer sends the buffer in chunks when it has nothing
+// better to do and capture gets disarmed. Host must arm it again to get the next one.
 
-    // Setup prescaler.
-    // Slower we do measurement, better are results.
-    // Higher prescaler means lower frequency of ADC.
-    // Highest prescaler is 128. 16Mhz / 128 = 125khz.
+// Must be the same enum as the enum in typescript with the same name
+typedef enum {CaptureDisarmed = 0, CaptureArmed = 1, CaptureTriggered = 2, CaptureReady = 3} CaptureState;
+
+// Marks samples from oversampling windows with bad samples (or samples recorded before arming)
+#define AK_CAPTURE_INVALID_SAMPLE  0xFFFF
+
+GLOBAL$() {
+    STATIC_VAR$(u16 capture_buf[AK_CAPTURE_SAMPLES], initial = {});
+    STATIC_VAR$(u16 capture_next_idx);
+    STATIC_VAR$(u16 capture_post_trigger_samples);
+    STATIC_VAR$(u16 capture_sent_samples);
+    // Changed by ISR(ADC_vect) from CaptureTriggered to CaptureReady
+    STATIC_VAR$(volatile u8 capture_state, initial = CaptureDisarmed);
+
+    // Identifies capture in chunks, incremented on every trigger
+    STATIC_VAR$(u8 capture_id);
+
+    // New state of CO2 switch and clock when it happened
+    STATIC_VAR$(u8 capture_co2_state);
+    STATIC_VAR$(u24 capture_clock_deciseconds_since_midnight);
+}
+
+// Called from uart-command-receiver if 'R' command is received
+FUNCTION$(void arm_capture(const u8 arm)) {
+    if (!arm) {
+        capture_state = CaptureDisarmed;
+        return;
+    }
+
+    // Capture that is being recorded or sent is not interrupted
+    if (capture_state != CaptureDisarmed) {
+        return;
+    }
+
+    for (u16 i = 0; i < AK_CAPTURE_SAMPLES; i++) {
+        capture_buf[i] = AK_CAPTURE_INVALID_SAMPLE;
+    }
+
+    capture_state = CaptureArmed;
+}
+
+// Called by controller_tick when it switches CO2
+FUNCTION$(void trigger_capture(const u8 new_co2_state, const u24 clock_deciseconds_since_midnight)) {
+    if (capture_state != CaptureArmed) {
+        return;
+    }
+
+    capture_id += 1;
+    capture_co2_state = new_co2_state;
+    capture_clock_deciseconds_since_midnight = clock_deciseconds_since_midnight;
+
+    // ISR(ADC_vect) must not see CaptureTriggered before the counter is reset
+    cli();
+    capture_post_trigger_samples = 0;
+    capture_state = CaptureTriggered;
+    sei();
+}
+
+// Called by ISR(ADC_vect) for every decimated sample
+FUNCTION$(void capture_sample(const u16 sample)) {
+    if (capture_state != CaptureArmed && capture_state != CaptureTriggered) {
+        return;
+    }
+
+    capture_buf[capture_next_idx] = sample;
+    capture_next_idx = (capture_next_idx + 1) & (AK_CAPTURE_SAMPLES - 1);
+
+    if (capture_state == CaptureTriggered) {
+        capture_post_trigger_samples += 1;
+        if (capture_post_trigger_samples == AK_CAPTURE_SAMPLES - AK_CAPTURE_PRE_TRIGGER_SAMPLES) {
+            // The oldest sample is at capture_next_idx now
+            capture_sent_samples = 0;
+            capture_state = CaptureReady;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+// Performance counter
+
+// Measure how many iteration we are able to perform between decisecond ticks
+// We use internal counter which we increment in every iteration of main loop
+// and then we copy the counter to main_loop_iterations_in_last_decisecond
+// every decisecond and reset the internal counter.
+// Lowe the value in main_loop_iterations_in_last_decisecond, busyier the loop!
+
+GLOBAL$() {
+    STATIC_VAR$(u32 __current_main_loop_iterations);
+    STATIC_VAR$(u32 main_loop_iterations_in_last_decisecond);
+}
+
+RUNNABLE$(performance_runnable) {
+    __current_main_loop_iterations += 1;
+}
+
+X_EVERY_DECISECOND$(performance_ticker) {
+    main_loop_iterations_in_last_decisecond = __current_main_loop_iterations;
+    __current_main_loop_iterations = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+// Schedule
+
+// Every transition sets state of all outputs at the given minute of the day.
+// State before the first transition of the day is defined by the last transition.
+// Host uploads profiles one by one (profile index followed by ScheduleProfile),
+// they are stored in EEPROM. AVR is little-endian and doesn't pad structures!
+// Uploaded structures are packed anyway, so the native build (host/sim.c) has the same layout.
+
+// Must be the same enum as the enum in typescript with the same name
+typedef enum {ScheduleDayLight = 1, ScheduleNightLight = 2, ScheduleCo2 = 4} ScheduleOutput;
+
+typedef struct __attribute__((packed)) {
+    u16 minute;   // Minute of the day (0..1439)
+    u8 outputs;   // ScheduleOutput bits
+} ScheduleTransition;
+
+typedef struct __attribute__((packed)) {
+    u8 transitions_count;  // 1..AK_SCHEDULE_MAX_TRANSITIONS, unused transitions must be zero
+    ScheduleTransition transitions[AK_SCHEDULE_MAX_TRANSITIONS];
+} ScheduleProfile;
+
+// Host uploads exactly this number of bytes (see asScheduleProfileBytes in AvrServiceImpl.ts)
+_Static_assert(sizeof(ScheduleProfile) == 1 + AK_SCHEDULE_MAX_TRANSITIONS * 3, "ScheduleProfile must not be padded");
+
+#define AK_NORM_DAY_SCHEDULE_PROFILE                                                        \
+    {4, {{0, ScheduleNightLight},                                                           \
+         {(AK_NORM_DAY_START_HOUR - AK_CO2_DAY_PRE_START_HOURS) * 60, ScheduleNightLight | ScheduleCo2}, \
+         {AK_NORM_DAY_START_HOUR * 60, ScheduleDayLight | ScheduleCo2},                     \
+         {AK_NORM_DAY_END_HOUR * 60, ScheduleNightLight}}}
+
+// No night light during night when alternative day is enabled
+#define AK_ALT_DAY_SCHEDULE_PROFILE                                                         \
+    {6, {{0, 0},                                                                            \
+         {(AK_ALT_DAY_START_HOUR - AK_CO2_DAY_PRE_START_HOURS) * 60, ScheduleCo2},          \
+         {AK_ALT_DAY_START_HOUR * 60, ScheduleDayLight | ScheduleCo2},                      \
+         {AK_ALT_DAY_NAP_START_HOUR * 60, ScheduleCo2},                                     \
+         {AK_ALT_DAY_NAP_END_HOUR * 60, ScheduleDayLight | ScheduleCo2},                    \
+         {AK_ALT_DAY_END_HOUR * 60, 0}}}
+
+// Used for profiles that are not (validly) stored in EEPROM
+static const ScheduleProfile schedule_defaults[AK_SCHEDULE_PROFILES] PROGMEM = {
+    AK_NORM_DAY_SCHEDULE_PROFILE,
+    AK_ALT_DAY_SCHEDULE_PROFILE,
+    AK_NORM_DAY_SCHEDULE_PROFILE,
+    AK_NORM_DAY_SCHEDULE_PROFILE
+};
+
+static ScheduleProfile EEMEM schedule_eeprom[AK_SCHEDULE_PROFILES];
+static u8 EEMEM schedule_eeprom_crc[AK_SCHEDULE_PROFILES];
+
+GLOBAL$() {
+    STATIC_VAR$(ScheduleProfile schedule[AK_SCHEDULE_PROFILES], initial = {});
+
+    // CRC of the whole schedule table, host compares it against its own one
+    STATIC_VAR$(u8 schedule_crc);
+
+    // Selected profile (0 - normal day, 1 - alternative day, ...)
+    STATIC_VAR$(u8 schedule_profile, initial = 0);
+
+    // Interval of the day [from, until) where outputs don't change.
+    // Lookup is only performed when we get out of the interval.
+    STATIC_VAR$(u8 schedule_cache_valid);
+    STATIC_VAR$(u24 schedule_cached_from);
+    STATIC_VAR$(u24 schedule_cached_until);
+    STATIC_VAR$(u8 schedule_cached_outputs);
+}
+
+FUNCTION$(u8 is_valid_schedule_profile(const ScheduleProfile * const p)) {
+    if (!p->transitions_count || p->transitions_count > AK_SCHEDULE_MAX_TRANSITIONS) {
+        return 0;
+    }
+
+    u16 prev_minute = 0;
+    for (u8 i = 0; i < p->transitions_count; i++) {
+        const u16 minute = p->transitions[i].minute;
+        if (minute < prev_minute || minute >= 24 * 60) {
+            return 0;
+        }
+        prev_minute = minute;
+    }
+
+    return AKAT_ONE;
+}
+
+// Must be called whenever schedule table or selected profile changes
+FUNCTION$(void schedule_changed()) {
+    schedule_crc = akat_crc_add_bytes(0, (const u8 *)schedule, sizeof(schedule));
+    schedule_cache_valid = 0;
+}
+
+X_INIT$(load_schedule) {
+    for (u8 i = 0; i < AK_SCHEDULE_PROFILES; i++) {
+        ScheduleProfile * const p = &schedule[i];
+        eeprom_read_block(p, &schedule_eeprom[i], sizeof(ScheduleProfile));
+
+        const u8 crc = eeprom_read_byte(&schedule_eeprom_crc[i]);
+        if (akat_crc_add_bytes(0, (const u8 *)p, sizeof(ScheduleProfile)) != crc || !is_valid_schedule_profile(p)) {
+            memcpy_P(p, &schedule_defaults[i], sizeof(ScheduleProfile));
+        }
+    }
+
+    schedule_changed();
+}
+
+// Called when host commits ScheduleProfileUpload
+FUNCTION$(void commit_schedule_profile_upload()) {
+    const ScheduleProfile * const p = (const ScheduleProfile *)(upload_buf + 1);
+    const u8 profile = upload_buf[0];
+
+    if (!is_valid_upload(1 + sizeof(ScheduleProfile)) || profile >= AK_SCHEDULE_PROFILES || !is_valid_schedule_profile(p)) {
+        count_upload_error(ScheduleProfileUpload);
+        return;
+    }
+
+    schedule[profile] = *p;
+
+    // Update writes only bytes that are changed
+    eeprom_update_block(p, &schedule_eeprom[profile], sizeof(ScheduleProfile));
+    eeprom_update_byte(&schedule_eeprom_crc[profile], akat_crc_add_bytes(0, (const u8 *)p, sizeof(ScheduleProfile)));
+
+    schedule_changed();
+}
+
+// Returns ScheduleOutput bits of the selected profile for the given time
+FUNCTION$(u8 get_schedule_outputs(const u24 deciseconds_since_midnight)) {
+    if (schedule_cache_valid && deciseconds_since_midnight >= schedule_cached_from && deciseconds_since_midnight < schedule_cached_until) {
+        return schedule_cached_outputs;
+    }
+
+    const ScheduleProfile * const p = &schedule[schedule_profile];
+
+    schedule_cached_outputs = p->transitions[p->transitions_count - 1].outputs;
+    schedule_cached_from = 0;
+    schedule_cached_until = AK_NUMBER_DECISECONDS_IN_DAY;
+
+    for (u8 i = 0; i < p->transitions_count; i++) {
+        const u24 transition = p->transitions[i].minute * 600L;
+        if (transition > deciseconds_since_midnight) {
+            schedule_cached_until = transition;
+            break;
+        }
+
+        schedule_cached_outputs = p->transitions[i].outputs;
+        schedule_cached_from = transition;
+    }
+
+    schedule_cache_valid = AKAT_ONE;
+    return schedule_cached_outputs;
+}
+
+// Finds interval [from, until) where the given output of the selected profile is continuously on
+// around the given time. Interval might wrap around midnight (from > until) or it might be the whole day
+// (from == until). Returns zero if the output is off at the given time.
+FUNCTION$(u8 get_schedule_output_interval(const u8 output, const u24 deciseconds_since_midnight, u24 *from, u24 *until)) {
+    const ScheduleProfile * const p = &schedule[schedule_profile];
+    const u8 n = p->transitions_count;
+
+    // Transition that defines the current state, the last one if we are before the first one
+    u8 current = n - 1;
+    for (u8 i = 0; i < n; i++) {
+        if (p->transitions[i].minute * 600L > deciseconds_since_midnight) {
+            break;
+        }
+        current = i;
+    }
+
+    if (!(p->transitions[current].outputs & output)) {
+        return 0;
+    }
+
+    u8 first = current;
+    u8 steps = 0;
+    while (steps < n) {
+        const u8 prev = first ? first - 1 : n - 1;
+        if (!(p->transitions[prev].outputs & output)) {
+            break;
+        }
+        first = prev;
+        steps += 1;
+    }
+
+    if (steps == n) {
+        *from = *until = 0;
+        return AKAT_ONE;
+    }
+
+    u8 last = current;
+    for (;;) {
+        const u8 next = last + 1 < n ? last + 1 : 0;
+        if (!(p->transitions[next].outputs & output)) {
+            *until = p->transitions[next].minute * 600L;
+            break;
+        }
+        last = next;
+    }
+
+    *from = p->transitions[first].minute * 600L;
+    return AKAT_ONE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+// Control
+
+// Safe state of all these outputs is 0, see 'rearm_safe_output_timer'
+X_GPIO_OUTPUT$(day_light_switch, A4);
+X_GPIO_OUTPUT$(night_light_switch, A5);
+X_GPIO_OUTPUT$(co2_switch, A6);
+
+FUNCTION$(void day_light_switch_timer_expired()) {
+    if (!rearm_safe_output_timer(DayLightSwitchTimer)) {
+        if (day_light_switch.is_set()) {
+            log_event(EventSafeOutputOff, DayLightSwitchTimer);
+        }
+        day_light_switch.set(0);
+    }
+}
+
+FUNCTION$(void night_light_switch_timer_expired()) {
+    if (!rearm_safe_output_timer(NightLightSwitchTimer)) {
+        if (night_light_switch.is_set()) {
+            log_event(EventSafeOutputOff, NightLightSwitchTimer);
+        }
+        night_light_switch.set(0);
+    }
+}
+
+FUNCTION$(void co2_switch_timer_expired()) {
+    if (!rearm_safe_output_timer(Co2SwitchTimer)) {
+        if (co2_switch.is_set()) {
+            log_event(EventSafeOutputOff, Co2SwitchTimer);
+        }
+        co2_switch.set(0);
+    }
+}
+
+X_INIT$(safe_outputs_init) {
+    day_light_switch.set(0);
+    night_light_switch.set(0);
+    co2_switch.set(0);
+
+    timers[DayLightSwitchTimer].callback = day_light_switch_timer_expired;
+    timers[NightLightSwitchTimer].callback = night_light_switch_timer_expired;
+    timers[Co2SwitchTimer].callback = co2_switch_timer_expired;
+
+    arm_timer(DayLightSwitchTimer, AK_SAFE_OUTPUT_CHECK_DECISECONDS);
+    arm_timer(NightLightSwitchTimer, AK_SAFE_OUTPUT_CHECK_DECISECONDS);
+    arm_timer(Co2SwitchTimer, AK_SAFE_OUTPUT_CHECK_DECISECONDS);
+}
+
+// - - - - - - - - - - - - - - - -  LIGHT DIMMING - - - - - -
+
+// Lights are also dimmed with Timer4 PWM (OC4A - day light, OC4B - night light), so that they are
+// switched smoothly (sunrise / sunset ramps at the edges of light intervals of the schedule).
+// Waveform is generated by hardware, so we only update compare registers every decisecond.
+// Safe state of dimmers is 0 (the same semantics as of the switches above).
+
+// Must go in the same order as the corresponding TimerId
+typedef enum {DayLightDimmer = 0, NightLightDimmer = 1, DimmersCount} Dimmer;
+
+typedef enum {LinearRamp = 0, GammaRamp = 1} DimmerRamp;
+
+// Perceived brightness is not linear, gamma 2.2: duty = AK_DIMMER_PWM_TOP * (level / 255) ^ 2.2
+static const u16 dimmer_gamma[256] PROGMEM = {
+       0,    0,    0,    0,    0,    0,    0,    0,    1,    1,    1,    1,    1,    1,    2,    2,
+       2,    3,    3,    3,    4,    4,    5,    5,    6,    6,    7,    7,    8,    9,    9,   10,
+      11,   11,   12,   13,   14,   15,   16,   16,   17,   18,   19,   20,   21,   23,   24,   25,
+      26,   27,   28,   30,   31,   32,   34,   35,   36,   38,   39,   41,   42,   44,   46,   47,
+      49,   51,   52,   54,   56,   58,   60,   61,   63,   65,   67,   69,   71,   73,   76,   78,
+      80,   82,   84,   87,   89,   91,   94,   96,   98,  101,  103,  106,  109,  111,  114,  117,
+     119,  122,  125,  128,  130,  133,  136,  139,  142,  145,  148,  151,  155,  158,  161,  164,
+     167,  171,  174,  177,  181,  184,  188,  191,  195,  198,  202,  206,  209,  213,  217,  221,
+     225,  228,  232,  236,  240,  244,  248,  252,  257,  261,  265,  269,  274,  278,  282,  287,
+     291,  295,  300,  304,  309,  314,  318,  323,  328,  333,  337,  342,  347,  352,  357,  362,
+     367,  372,  377,  382,  387,  393,  398,  403,  408,  414,  419,  425,  430,  436,  441,  447,
+     452,  458,  464,  470,  475,  481,  487,  493,  499,  505,  511,  517,  523,  529,  535,  542,
+     548,  554,  561,  567,  573,  580,  586,  593,  599,  606,  613,  619,  626,  633,  640,  647,
+     653,  660,  667,  674,  681,  689,  696,  703,  710,  717,  725,  732,  739,  747,  754,  762,
+     769,  777,  784,  792,  800,  807,  815,  823,  831,  839,  847,  855,  863,  871,  879,  887,
+     895,  903,  912,  920,  928,  937,  945,  954,  962,  971,  979,  988,  997, 1005, 1014, 1023
+};
+
+GLOBAL$() {
+    // Brightness levels (0..255) before ramp profile is applied
+    STATIC_VAR$(u8 dimmer_levels[DimmersCount], initial = {});
+}
+
+// Sets PWM duty directly, zero duty disconnects output compare (fast PWM makes a spike even with zero)
+FUNCTION$(void set_dimmer_duty(const u8 dimmer, const u16 duty)) {
+    const u8 com = dimmer == DayLightDimmer ? H(COM4A1) : H(COM4B1);
+
+    if (dimmer == DayLightDimmer) {
+        OCR4A = duty;
+    } else {
+        OCR4B = duty;
+    }
+
+    if (duty) {
+        TCCR4A |= com;
+    } else {
+        TCCR4A &= ~com;
+    }
+}
+
+FUNCTION$(void set_dimmer(const u8 dimmer, const u8 level, const u8 ramp)) {
+    u16 duty;
+    if (ramp == GammaRamp) {
+        duty = pgm_read_word(&dimmer_gamma[level]);
+    } else {
+        // 8 bits into 10 bits
+        duty = ((u16)level << 2) | (level >> 6);
+    }
+
+    set_dimmer_duty(dimmer, duty);
+    dimmer_levels[dimmer] = level;
+    touch_safe_output_timer(DayLightDimmerTimer + dimmer);
+}
+
+FUNCTION$(void day_light_dimmer_timer_expired()) {
+    if (!rearm_safe_output_timer(DayLightDimmerTimer)) {
+        set_dimmer_duty(DayLightDimmer, 0);
+        dimmer_levels[DayLightDimmer] = 0;
+    }
+}
+
+FUNCTION$(void night_light_dimmer_timer_expired()) {
+    if (!rearm_safe_output_timer(NightLightDimmerTimer)) {
+        set_dimmer_duty(NightLightDimmer, 0);
+        dimmer_levels[NightLightDimmer] = 0;
+    }
+}
+
+X_INIT$(dimmers_init) {
+    // Output compare pins, they are low until output compare is connected
+    PORTH &= ~(H(PH3) | H(PH4));
+    DDRH |= H(PH3) | H(PH4);
+
+    // Fast PWM with ICR4 as TOP (mode 14), no prescaler
+    ICR4 = AK_DIMMER_PWM_TOP;
+    TCCR4A = H(WGM41);
+    TCCR4B = H(WGM43) | H(WGM42) | H(CS40);
+
+    timers[DayLightDimmerTimer].callback = day_light_dimmer_timer_expired;
+    timers[NightLightDimmerTimer].callback = night_light_dimmer_timer_expired;
+
+    arm_timer(DayLightDimmerTimer, AK_SAFE_OUTPUT_CHECK_DECISECONDS);
+    arm_timer(NightLightDimmerTimer, AK_SAFE_OUTPUT_CHECK_DECISECONDS);
+}
+
+// Returns level (0..255) for a light that is on at the given time within the given interval of the schedule,
+// i.e. ramps up after the interval starts and ramps down before it ends.
+FUNCTION$(u8 get_ramp_level(const u24 deciseconds_since_midnight, const u24 from, const u24 until)) {
+    if (from == until) {
+        return 255;
+    }
+
+    u24 elapsed = deciseconds_since_midnight + AK_NUMBER_DECISECONDS_IN_DAY - from;
+    if (elapsed >= AK_NUMBER_DECISECONDS_IN_DAY) {
+        elapsed -= AK_NUMBER_DECISECONDS_IN_DAY;
+    }
+
+    u24 remaining = until + AK_NUMBER_DECISECONDS_IN_DAY - deciseconds_since_midnight;
+    if (remaining >= AK_NUMBER_DECISECONDS_IN_DAY) {
+        remaining -= AK_NUMBER_DECISECONDS_IN_DAY;
+    }
+
+    const u24 edge = elapsed < remaining ? elapsed : remaining;
+    if (edge >= AK_LIGHT_RAMP_DECISECONDS) {
+        return 255;
+    }
+
+    return (u8)((u32)edge * 255 / AK_LIGHT_RAMP_DECISECONDS);
+}
+
+GLOBAL$() {
+    // Clock used to calculate state
+    STATIC_VAR$(u24 clock_deciseconds_since_midnight,
+                initial = AK_NUMBER_OF_CLOCK_DECISECONDS_AT_STARTUP);
+
+    // Last calculated drift of our clock comapred to data we got from server
+    // This one is signed integer!
+    STATIC_VAR$(i24 last_drift_of_clock_deciseconds_since_midnight,
+                initial = 0);
+
+    // Protects against spam / malfunction / misuse
+    STATIC_VAR$(u8 light_forces_since_protection_stat_reset);
+    STATIC_VAR$(u8 clock_corrections_since_protection_stat_reset);
+
+    // Host sends clock every 10 seconds, so rejected correction is logged once per protection period
+    STATIC_VAR$(u8 clock_correction_rejection_logged);
+
+    // These variables indicate correction stuff received from raspberry-pi (i.e. via USB)
+    STATIC_VAR$(u8 received_clock0); // LSByte
+    STATIC_VAR$(u8 received_clock1);
+    STATIC_VAR$(u8 received_clock2, initial = 255); // MSByte. 255 means nothing is received
+
+    // CO2 protection - - -
+    STATIC_VAR$(u24 co2_deciseconds_until_can_turn_on,
+                initial = AK_CO2_OFF_MINUTES_BEFORE_UNLOCKED * 60L * 10L);
+
+    // Whether it's day or not as calculated by AVR's internal algorithm and interval
+    STATIC_VAR$(u8 co2_calculated_day, initial = 0);
+
+    // Set when PH is too low for too long, see 'ph_ticker'
+    STATIC_VAR$(u8 ph_safety_co2_lockout, initial = 0);
+
+    // CO2 state required by on-MCU controller, see 'co2_curve_ticker'
+    STATIC_VAR$(u8 co2_curve_mode, initial = Co2CurveDisabled);
+    STATIC_VAR$(u8 co2_curve_required_state, initial = 0);
+    STATIC_VAR$(u8 co2_curve_in_control, initial = 0);
+
+    // Light and CO2-day states are only recalculated when clock reaches the next transition
+    // of the schedule or when something that affects them changes, see 'controller_tick'.
+    STATIC_VAR$(u8 controller_valid, initial = 0);
+    STATIC_VAR$(u24 controller_next_transition);
+    STATIC_VAR$(u8 controller_forces);
+    STATIC_VAR$(u8 controller_day_light_state);
+    STATIC_VAR$(u8 controller_night_light_state);
+
+    // Light intervals of the schedule (see 'get_schedule_output_interval'), used for ramps
+    STATIC_VAR$(u8 controller_day_light_scheduled);
+    STATIC_VAR$(u24 controller_day_light_from);
+    STATIC_VAR$(u24 controller_day_light_until);
+    STATIC_VAR$(u8 controller_night_light_scheduled);
+    STATIC_VAR$(u24 controller_night_light_from);
+    STATIC_VAR$(u24 controller_night_light_until);
+}
+
+// State that raspberry pi CO2-controlling algorithm wants to set and forced states
+// are timed flags, see 'set_timed_flag' and AK_*_TIMEOUT_DECISECONDS.
+
+// - - - - - - - - - - - - - - - -  CLOCK TRIMMING - - - - - -
+
+// Crystal frequency is not calibrated (see X_CPU$), so we learn its error from the history
+// of drift between our clock and the clock received from host. The error is compensated by making
+// some of Timer1 periods one tick longer or shorter (Bresenham-style), one tick is 40 ppm.
+// Learned error is stored in EEPROM, so clock is accurate after restart even without host.
+
+GLOBAL$() {
+    // Crystal error in 1/8 ppm, positive means that crystal is fast (so periods are made longer)
+    STATIC_VAR$(i16 clock_trim_ppm_x8);
+    STATIC_VAR$(i16 clock_trim_stored_ppm_x8);
+
+    // Whole number of ticks added to every period and a fraction (in 1/8 ppm) accumulated every period
+    STATIC_VAR$(i8 clock_trim_ticks);
+    STATIC_VAR$(u16 clock_trim_fraction);
+    STATIC_VAR$(u16 clock_trim_accumulator);
+
+    // Sum of all corrections applied to our clock, so that drift history is continuous
+    STATIC_VAR$(i32 clock_applied_corrections_deciseconds);
+
+    // Phase adjustment requested by host (see AK_TIME_SYNC_PHASE_TICKS_PER_UNIT) and sum of all applied ones
+    STATIC_VAR$(i8 clock_phase_adjustment);
+    STATIC_VAR$(i32 clock_phase_adjusted_ticks);
+
+    // Drift samples of the current window in 1/16 decisecond (relative to the first sample of the window)
+    STATIC_VAR$(i32 clock_trim_window_base_x16);
+    STATIC_VAR$(i32 clock_trim_window_sum);
+    STATIC_VAR$(u16 clock_trim_window_samples);
+
+    // Mean drift of the previous window (in 1/16 decisecond)
+    STATIC_VAR$(i32 clock_trim_prev_window_mean_x16);
+    STATIC_VAR$(u8 clock_trim_prev_window_valid);
+}
+
+static i16 EEMEM clock_trim_eeprom;
+static u8 EEMEM clock_trim_eeprom_crc;
+
+FUNCTION$(void set_clock_trim(i16 ppm_x8)) {
+    if (ppm_x8 > AK_CLOCK_TRIM_MAX_PPM_X8) {
+        ppm_x8 = AK_CLOCK_TRIM_MAX_PPM_X8;
+    } else if (ppm_x8 < -AK_CLOCK_TRIM_MAX_PPM_X8) {
+        ppm_x8 = -AK_CLOCK_TRIM_MAX_PPM_X8;
+    }
+
+    // Floor division, fraction must be non-negative
+    i16 ticks = ppm_x8 / AK_CLOCK_TRIM_PPM_X8_PER_TICK;
+    i16 fraction = ppm_x8 - ticks * AK_CLOCK_TRIM_PPM_X8_PER_TICK;
+    if (fraction < 0) {
+        fraction += AK_CLOCK_TRIM_PPM_X8_PER_TICK;
+        ticks -= 1;
+    }
+
+    clock_trim_ppm_x8 = ppm_x8;
+    clock_trim_ticks = (i8)ticks;
+    clock_trim_fraction = (u16)fraction;
+}
+
+X_INIT$(load_clock_trim) {
+    i16 ppm_x8 = (i16)eeprom_read_word((const u16 *)&clock_trim_eeprom);
+    const u8 crc = eeprom_read_byte(&clock_trim_eeprom_crc);
+    if (akat_crc_add_bytes(0, (const u8 *)&ppm_x8, sizeof(ppm_x8)) != crc) {
+        ppm_x8 = 0;
+    }
+
+    set_clock_trim(ppm_x8);
+    clock_trim_stored_ppm_x8 = clock_trim_ppm_x8;
+}
+
+X_EVERY_DECISECOND$(clock_trim_ticker) {
+    // We are called right after compare match, so the new value applies to the period that has just started
+    u16 top = (u16)(AK_TIMER1_NOMINAL_TOP + (i16)clock_trim_ticks);
+
+    clock_trim_accumulator += clock_trim_fraction;
+    if (clock_trim_accumulator >= AK_CLOCK_TRIM_PPM_X8_PER_TICK) {
+        clock_trim_accumulator -= AK_CLOCK_TRIM_PPM_X8_PER_TICK;
+        top += 1;
+    }
+
+    // Period might be made shorter only if Timer1 hasn't gone too far yet, otherwise it would miss the compare match.
+    // Interrupts are disabled because USART0 ISR reads TCNT1 and 16-bit registers share TEMP register.
+    const i16 phase_ticks = (i16)clock_phase_adjustment * AK_TIME_SYNC_PHASE_TICKS_PER_UNIT;
+    clock_phase_adjustment = 0;
+
+    const u16 phase_top = top + (u16)phase_ticks;
+
+    cli();
+    if (phase_ticks > 0 || (phase_ticks < 0 && TCNT1 + AK_TIME_SYNC_PHASE_MIN_TICKS_AHEAD < phase_top)) {
+        top = phase_top;
+        clock_phase_adjusted_ticks += phase_ticks;
+    }
+    OCR1A = top;
+    sei();
+}
+
+// Called for every clock received from host, drift is already normalized (i.e. midnight is handled)
+FUNCTION$(void add_clock_trim_sample(const i24 drift)) {
+    // Probably host clock has jumped, don't let it spoil the estimate
+    if (drift > AK_CLOCK_TRIM_MAX_SAMPLE_DRIFT_DECISECONDS || drift < -AK_CLOCK_TRIM_MAX_SAMPLE_DRIFT_DECISECONDS) {
+        return;
+    }
+
+    // Phase adjustments requested by host make our clock go behind, they are not crystal error
+    const i32 continuous_drift_x16 = (clock_applied_corrections_deciseconds + drift) * 16
+                                     - clock_phase_adjusted_ticks / AK_CLOCK_TRIM_TICKS_PER_X16;
+    if (!clock_trim_window_samples) {
+        clock_trim_window_base_x16 = continuous_drift_x16;
+        clock_trim_window_sum = 0;
+    }
+
+    if (clock_trim_window_samples < 0xFFFF) {
+        clock_trim_window_sum += continuous_drift_x16 - clock_trim_window_base_x16;
+        clock_trim_window_samples += 1;
+    }
+}
+
+// Compares mean drift of this hour to the mean drift of the previous hour.
+// A single sample is quantized to a decisecond, but mean of hundreds of samples is much more precise.
+X_EVERY_HOUR$(clock_trim_window) {
+    if (clock_trim_window_samples < AK_CLOCK_TRIM_MIN_WINDOW_SAMPLES) {
+        clock_trim_window_samples = 0;
+        clock_trim_prev_window_valid = 0;
+        return;
+    }
+
+    const i32 mean_x16 = clock_trim_window_base_x16 + clock_trim_window_sum / (i32)clock_trim_window_samples;
+    clock_trim_window_samples = 0;
+
+    if (clock_trim_prev_window_valid) {
+        // How much host clock has gone ahead of ours during one hour (36000 deciseconds)
+        i32 delta_x16 = mean_x16 - clock_trim_prev_window_mean_x16;
+        if (delta_x16 > AK_CLOCK_TRIM_MAX_HOURLY_DELTA_X16) {
+            delta_x16 = AK_CLOCK_TRIM_MAX_HOURLY_DELTA_X16;
+        } else if (delta_x16 < -AK_CLOCK_TRIM_MAX_HOURLY_DELTA_X16) {
+            delta_x16 = -AK_CLOCK_TRIM_MAX_HOURLY_DELTA_X16;
+        }
+
+        // delta / 16 / 36000 * 1000000 * 8 = delta * 125 / 9
+        const i32 residual_ppm_x8 = delta_x16 * 125 / 9;
+
+        // Host clock gone ahead means that our crystal is slow. Don't apply the whole residual
+        // at once, so that jitter of host clock and rare jumps are filtered out.
+        set_clock_trim((i16)((i32)clock_trim_ppm_x8 - residual_ppm_x8 / AK_CLOCK_TRIM_GAIN_DIVISOR));
+
+        // Don't wear EEPROM with changes below 1 ppm
+        const i16 unstored_ppm_x8 = clock_trim_ppm_x8 - clock_trim_stored_ppm_x8;
+        if (unstored_ppm_x8 >= 8 || unstored_ppm_x8 <= -8) {
+            eeprom_update_word((u16 *)&clock_trim_eeprom, (u16)clock_trim_ppm_x8);
+            eeprom_update_byte(&clock_trim_eeprom_crc,
+                               akat_crc_add_bytes(0, (const u8 *)&clock_trim_ppm_x8, sizeof(clock_trim_ppm_x8)));
+            clock_trim_stored_ppm_x8 = clock_trim_ppm_x8;
+        }
+    }
+
+    clock_trim_prev_window_mean_x16 = mean_x16;
+    clock_trim_prev_window_valid = AKAT_ONE;
+}
+
+X_EVERY_HOUR$(reset_protection_stats) {
+    light_forces_since_protection_stat_reset = 0;
+    clock_corrections_since_protection_stat_reset = 0;
+    clock_correction_rejection_logged = 0;
+}
+
+// Forces are reset by the timer wheel, callbacks only log it
+FUNCTION$(void day_light_force_expired()) {
+    log_event(EventForceExpired, DayLightForcedTimer);
+}
+
+FUNCTION$(void night_light_force_expired()) {
+    log_event(EventForceExpired, NightLightForcedTimer);
+}
+
+FUNCTION$(void co2_force_off_expired()) {
+    log_event(EventForceExpired, Co2ForceOffTimer);
+}
+
+X_INIT$(forces_init) {
+    timers[DayLightForcedTimer].callback = day_light_force_expired;
+    timers[NightLightForcedTimer].callback = night_light_force_expired;
+    timers[Co2ForceOffTimer].callback = co2_force_off_expired;
+}
+
+// Called from uart-command-receiver if force-light command is received from raspberry-pi
+// Note that if we force something, then it will be automatically reset by
+// the timer wheel after AK_FORCE_TIMEOUT_DECISECONDS.
+FUNCTION$(void force_light(const LightForceMode mode)) {
+    if (mode == NotForced) {
+        if (is_timer_armed(DayLightForcedTimer) || is_timer_armed(NightLightForcedTimer)) {
+            log_event(EventLightForced, mode);
+        }
+        set_timed_flag(DayLightForcedTimer, 0, AK_FORCE_TIMEOUT_DECISECONDS);
+        set_timed_flag(NightLightForcedTimer, 0, AK_FORCE_TIMEOUT_DECISECONDS);
+        return;
+    }
+
+    if (light_forces_since_protection_stat_reset >= AK_MAX_LIGHT_FORCES_WITHIN_ONE_HOUR) {
+        log_event(EventProtectionRejected, LightForceRejected);
+        return;
+    }
+
+    log_event(EventLightForced, mode);
+
+    if (mode == Day) {
+        set_timed_flag(DayLightForcedTimer, 1, AK_FORCE_TIMEOUT_DECISECONDS);
+        set_timed_flag(NightLightForcedTimer, 0, AK_FORCE_TIMEOUT_DECISECONDS);
+    } else {
+        set_timed_flag(DayLightForcedTimer, 0, AK_FORCE_TIMEOUT_DECISECONDS);
+        set_timed_flag(NightLightForcedTimer, 1, AK_FORCE_TIMEOUT_DECISECONDS);
+    }
+
+    light_forces_since_protection_stat_reset += 1;
+}
+
+// Called from uart-command-receiver if set-co2 switch command is received from raspberry-pi
+FUNCTION$(void update_co2_switch_state(const u8 new_state)) {
+    set_timed_flag(RequiredCo2SwitchStateTimer, new_state, AK_REQUIRED_CO2_SWITCH_STATE_TIMEOUT_DECISECONDS);
+    arm_timer(Co2HostCommandsTimer, AK_CO2_HOST_TIMEOUT_DECISECONDS);
+}
+
+// Called from uart-command-receiver if set-schedule-profile command is received from raspberry-pi
+// We use force light protection to avoid misuse or bugs
+FUNCTION$(void set_schedule_profile(const u8 profile)) {
+    if (profile == schedule_profile || profile >= AK_SCHEDULE_PROFILES) {
+        return;
+    }
+
+    if (light_forces_since_protection_stat_reset >= AK_MAX_LIGHT_FORCES_WITHIN_ONE_HOUR) {
+        log_event(EventProtectionRejected, ScheduleProfileRejected);
+        return;
+    }
+
+    schedule_profile = profile;
+    schedule_changed();
+    light_forces_since_protection_stat_reset += 1;
+}
+
+// - - - - - - - - - - - -  - - - - - - - ---- - - -- - - - -  - - - -
+// - - - - - - - - - - - -  - - - - - - - ---- - - -- - - - -  - - - -
+// - - - - - - - - - - - -  - - - - - - - ---- - - -- - - - -  - - - -
+// Main function that performs state switching
+
+FUNCTION$(u8 is_day(const u24 deciseconds_since_midnight)) {
+    if (is_timer_armed(DayLightForcedTimer)) {
+        return AKAT_ONE;
+    }
+
+    if (is_timer_armed(NightLightForcedTimer)) {
+        return 0;
+    }
+
+    return (get_schedule_outputs(deciseconds_since_midnight) & ScheduleDayLight) ? AKAT_ONE : 0;
+}
+
+X_EVERY_DECISECOND$(controller_tick) {
+    // - - - - - - - - - - - - - - - -  CLOCK CORRECTION - - - - - -
+    u24 new_clock_deciseconds_since_midnight = clock_deciseconds_since_midnight + 1;
+    if (new_clock_deciseconds_since_midnight >= AK_NUMBER_DECISECONDS_IN_DAY) {
+        new_clock_deciseconds_since_midnight = 0;
+    }
+
+    if (received_clock2 != 255) {
+        u24 received_clock = (((u24)received_clock2) << 16) + (((u24)received_clock1) << 8) + received_clock0;
+
+        last_drift_of_clock_deciseconds_since_midnight = (i24)received_clock - (i24)clock_deciseconds_since_midnight;
+
+        // Same drift, but near midnight one of the clocks might have already wrapped
+        i24 drift = last_drift_of_clock_deciseconds_since_midnight;
+        if (drift > AK_NUMBER_DECISECONDS_IN_DAY / 2) {
+            drift -= AK_NUMBER_DECISECONDS_IN_DAY;
+        } else if (drift < -(AK_NUMBER_DECISECONDS_IN_DAY / 2)) {
+            drift += AK_NUMBER_DECISECONDS_IN_DAY;
+        }
+
+        add_clock_trim_sample(drift);
+
+        // Perform correction if drift is large than a limit
+        if (clock_corrections_since_protection_stat_reset < AK_MAX_CLOCK_CORRECTIONS_WITHIN_ONE_HOUR) {
+            if ((last_drift_of_clock_deciseconds_since_midnight >= AK_MAX_CLOCK_DRIFT_DECISECONDS) || (last_drift_of_clock_deciseconds_since_midnight <= -AK_MAX_CLOCK_DRIFT_DECISECONDS)) {
+                // Perform correction if correction doesn't affect light state..
+                // or if we can't delay correction any longer.
+                if ((is_day(received_clock) == is_day(new_clock_deciseconds_since_midnight))
+                        || (last_drift_of_clock_deciseconds_since_midnight >= AK_MAX_HARDLIMIT_CLOCK_DRIFT_DECISECONDS)
+                        || (last_drift_of_clock_deciseconds_since_midnight <= -AK_MAX_HARDLIMIT_CLOCK_DRIFT_DECISECONDS)) {
+                    // Perform correction...
+                    clock_corrections_since_protection_stat_reset += 1;
+                    new_clock_deciseconds_since_midnight = received_clock;
+
+                    // Without correction the clock would be one decisecond ahead of the sampled value
+                    clock_applied_corrections_deciseconds += drift - 1;
+                    controller_valid = 0;
+
+                    log_event(EventClockCorrected, (u16)(i16)(drift > 32767 ? 32767 : (drift < -32767 ? -32767 : drift)));
+                    TRACE_CLOCK_CORRECTED(drift, clock_trim_ppm_x8);
+                }
+            }
+        } else if (!clock_correction_rejection_logged
+                   && ((last_drift_of_clock_deciseconds_since_midnight >= AK_MAX_CLOCK_DRIFT_DECISECONDS) || (last_drift_of_clock_deciseconds_since_midnight <= -AK_MAX_CLOCK_DRIFT_DECISECONDS))) {
+            log_event(EventProtectionRejected, ClockCorrectionRejected);
+            clock_correction_rejection_logged = AKAT_ONE;
+        }
+    }
+
+    // We either have handled clock correction or ignored it.
+    // Anyway, invalidate current correction data
+    received_clock2 = 255;
+
+    // Finally set clock to new clock value, either corrected or normal one
+    clock_deciseconds_since_midnight = new_clock_deciseconds_since_midnight;
+
+    // - - - - - - - - - - - - - - - -  LIGHT AND CO2 DAY - - - - - -
+
+    // Forced flags time out by themselves, so we have to watch them
+    const u8 forces = (is_timer_armed(DayLightForcedTimer) ? 1 : 0) | (is_timer_armed(NightLightForcedTimer) ? 2 : 0);
+
+    // Nothing can change until the next transition unless clock is corrected, schedule is changed
+    // or lights are forced. Midnight is treated as a transition as clock starts from zero again.
+    if (!controller_valid
+            || !schedule_cache_valid
+            || forces != controller_forces
+            || clock_deciseconds_since_midnight >= controller_next_transition
+            || !clock_deciseconds_since_midnight) {
+        const u8 schedule_outputs = get_schedule_outputs(clock_deciseconds_since_midnight);
+
+        controller_next_transition = schedule_cached_until;
+        controller_day_light_state = is_day(clock_deciseconds_since_midnight);
+
+        // Night light is either forced or defined by schedule
+        controller_night_light_state = !controller_day_light_state
+                                       && (is_timer_armed(NightLightForcedTimer) || (schedule_outputs & ScheduleNightLight));
+
+        // Calculate day so it can be used also used for debugging
+        co2_calculated_day = (schedule_outputs & ScheduleCo2) ? AKAT_ONE : 0;
+
+        controller_day_light_scheduled = get_schedule_output_interval(
+            ScheduleDayLight, clock_deciseconds_since_midnight, &controller_day_light_from, &controller_day_light_until);
+        controller_night_light_scheduled = get_schedule_output_interval(
+            ScheduleNightLight, clock_deciseconds_since_midnight, &controller_night_light_from, &controller_night_light_until);
+
+        controller_forces = forces;
+        controller_valid = AKAT_ONE;
+    }
+
+    // - - - - - - - - - - - - - - - -  CO2 - - - - - -
+
+    // New CO2 state if by default OFF
+    u8 new_co2_state = 0;
+
+    // On-MCU controller either always decides or only when host is gone
+    co2_curve_in_control = co2_curve_mode == Co2CurveContinuous
+                           || (co2_curve_mode == Co2CurveFallback && !is_timer_armed(Co2HostCommandsTimer));
+
+    const u8 co2_required = co2_curve_in_control ? co2_curve_required_state : is_timer_armed(RequiredCo2SwitchStateTimer);
+
+    if (co2_deciseconds_until_can_turn_on) {
+        // We can't feed CO2, because we can't yet... (it was turned off recently)
+        co2_deciseconds_until_can_turn_on -= 1;
+    } else {
+        if (co2_required) {
+            // New state will be whether it's in co2 day or not
+            new_co2_state = co2_calculated_day && !is_timer_armed(Co2ForceOffTimer) && !ph_safety_co2_lockout;
+        }
+    }
+
+    // - - - - - - - - - - - - - - - -  STATE CHANGING - - - - - -
+
+    // Light (safe outputs must be confirmed regularly, see 'rearm_safe_output_timer')
+    if (!day_light_switch.is_set() != !controller_day_light_state) {
+        log_event(EventDayLightSwitched, controller_day_light_state);
+    }
+
+    if (!night_light_switch.is_set() != !controller_night_light_state) {
+        log_event(EventNightLightSwitched, controller_night_light_state);
+    }
+
+    day_light_switch.set(controller_day_light_state);
+    night_light_switch.set(controller_night_light_state);
+    touch_safe_output_timer(DayLightSwitchTimer);
+    touch_safe_output_timer(NightLightSwitchTimer);
+
+    // Dimmers follow switches, forced lights and lights that are not scheduled go without ramp
+    u8 day_light_level = 0;
+    if (controller_day_light_state) {
+        day_light_level = (controller_day_light_scheduled && !is_timer_armed(DayLightForcedTimer))
+                          ? get_ramp_level(clock_deciseconds_since_midnight, controller_day_light_from, controller_day_light_until)
+                          : 255;
+    }
+
+    u8 night_light_level = 0;
+    if (controller_night_light_state) {
+        night_light_level = (controller_night_light_scheduled && !is_timer_armed(NightLightForcedTimer))
+                            ? get_ramp_level(clock_deciseconds_since_midnight, controller_night_light_from, controller_night_light_until)
+                            : 255;
+    }
+
+    set_dimmer(DayLightDimmer, day_light_level, AK_DAY_LIGHT_RAMP);
+    set_dimmer(NightLightDimmer, night_light_level, AK_NIGHT_LIGHT_RAMP);
+
+    // CO2
+    if (!co2_switch.is_set() != !new_co2_state) {
+        trigger_capture(new_co2_state, clock_deciseconds_since_midnight);
+        log_event(EventCo2Switched, new_co2_state);
+    }
+
+    if (co2_switch.is_set() && !new_co2_state) {
+        // We are turning CO2 off...
+        // Lock co2 switch so it can't be turned on too soon
+        co2_deciseconds_until_can_turn_on = AK_CO2_OFF_MINUTES_BEFORE_UNLOCKED * 60L * 10L;
+    }
+    co2_switch.set(new_co2_state);
+    touch_safe_output_timer(Co2SwitchTimer);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+// Warm restart
+
+// Control state is kept in RAM that is not initialized on startup (.noinit), so after watchdog,
+// brown-out or external reset (e.g. host opens serial port) we resume with the same clock,
+// CO2 lock, schedule profile and forced states instead of waiting for host to repair them.
+// State is protected by magic and CRC, and it's never used after power-on.
+
+#define AK_WARM_STATE_MAGIC  0xA55A
+
+// Must be the same as the number of timed flags in TimerId (they go first)
+#define AK_WARM_STATE_TIMED_FLAGS  4
+
+typedef struct {
+    u16 magic;
+    u24 clock_deciseconds_since_midnight;
+    u24 co2_deciseconds_until_can_turn_on;
+    u8 ph_safety_co2_lockout;
+    u8 schedule_profile;
+    u8 light_forces_since_protection_stat_reset;
+    u8 clock_corrections_since_protection_stat_reset;
+    u16 timed_flags_remaining_deciseconds[AK_WARM_STATE_TIMED_FLAGS];  // Zero if flag is not set
+    u8 crc;
+} WarmState;
+
+static WarmState warm_state __attribute__((section(".noinit")));
+
+// Reset cause, as it was in MCUSR when we started
+static u8 mcusr_at_startup __attribute__((section(".noinit")));
+
+// Runs before C runtime is initialized. After watchdog reset watchdog is still enabled (with the shortest
+// timeout) and WDRF must be cleared to disable it, otherwise we won't even get to AKAT initialization.
+void save_mcusr() __attribute__((naked, used, section(".init3")));
+void save_mcusr() {
+    mcusr_at_startup = MCUSR;
+    MCUSR = 0;
+    wdt_disable();
+}
+
+GLOBAL$() {
+    STATIC_VAR$(u8 warm_restarted, initial = 0);
+}
+
+X_INIT$(warm_restart) {
+    if ((mcusr_at_startup & H(PORF)) || !(mcusr_at_startup & (H(WDRF) | H(BORF) | H(EXTRF)))) {
+        return;
+    }
+
+    if (warm_state.magic != AK_WARM_STATE_MAGIC
+            || akat_crc_add_bytes(0, (const u8 *)&warm_state, sizeof(WarmState) - 1) != warm_state.crc
+            || warm_state.clock_deciseconds_since_midnight >= AK_NUMBER_DECISECONDS_IN_DAY
+            || warm_state.schedule_profile >= AK_SCHEDULE_PROFILES) {
+        return;
+    }
+
+    clock_deciseconds_since_midnight = warm_state.clock_deciseconds_since_midnight;
+    co2_deciseconds_until_can_turn_on = warm_state.co2_deciseconds_until_can_turn_on;
+    ph_safety_co2_lockout = warm_state.ph_safety_co2_lockout;
+    light_forces_since_protection_stat_reset = warm_state.light_forces_since_protection_stat_reset;
+    clock_corrections_since_protection_stat_reset = warm_state.clock_corrections_since_protection_stat_reset;
+
+    schedule_profile = warm_state.schedule_profile;
+    schedule_changed();
+
+    for (u8 i = 0; i < AK_WARM_STATE_TIMED_FLAGS; i++) {
+        if (warm_state.timed_flags_remaining_deciseconds[i]) {
+            arm_timer(i, warm_state.timed_flags_remaining_deciseconds[i]);
+        }
+    }
+
+    warm_restarted = AKAT_ONE;
+}
+
+X_INIT$(log_startup_event) {
+    log_event(EventStartup, mcusr_at_startup | ((u16)warm_restarted << 8));
+}
+
+// Must go after controller_tick, so that we save the state it has just calculated
+X_EVERY_DECISECOND$(warm_state_ticker) {
+    warm_state.magic = AK_WARM_STATE_MAGIC;
+    warm_state.clock_deciseconds_since_midnight = clock_deciseconds_since_midnight;
+    warm_state.co2_deciseconds_until_can_turn_on = co2_deciseconds_until_can_turn_on;
+    warm_state.ph_safety_co2_lockout = ph_safety_co2_lockout;
+    warm_state.schedule_profile = schedule_profile;
+    warm_state.light_forces_since_protection_stat_reset = light_forces_since_protection_stat_reset;
+    warm_state.clock_corrections_since_protection_stat_reset = clock_corrections_since_protection_stat_reset;
+
+    for (u8 i = 0; i < AK_WARM_STATE_TIMED_FLAGS; i++) {
+        warm_state.timed_flags_remaining_deciseconds[i] = get_timer_remaining_deciseconds(i);
+    }
+
+    warm_state.crc = akat_crc_add_bytes(0, (const u8 *)&warm_state, sizeof(WarmState) - 1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+// Uptime
+
+GLOBAL$() {
+    STATIC_VAR$(u32 uptime_deciseconds);
+}
+
+X_EVERY_DECISECOND$(uptime_ticker) {
+    uptime_deciseconds += 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+// Led pins
+
+X_GPIO_OUTPUT$(blue_led, B7);
+
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+// Watchdog
+
+X_WATCHDOG$(8s);
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+// Activity indication
+
+// This piece of code will be executed in akat event/thread loop every 1/10 second.
+// We use to turn the blue led ON and OFF
+X_EVERY_DECISECOND$(activity_led) {
+    STATIC_VAR$(u8 state);
+
+    blue_led.set(state);
+    state = !state;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+// DS18B20
+
+X_DS18B20$(ds18b20_aqua, A0);
+X_DS18B20$(ds18b20_case, A1);
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+// ADC
+
+X_INIT$(init_adc) {
+    // We just use default ADC channel (ADC0 marked as 'A0' on the PCB)
+    // No need to change or setup that. But we must select reference voltage for ADC.
+    // We use AVCC which is connected to VCC on the board.
+    ADMUX = H(REFS0);
+
+    // Setup prescaler.
+    // Slower we do measurement, better are results.
+    // Higher prescaler means lower frequency of ADC.
+    // Highest prescaler is 128. 16Mhz / 128 = 125khz.
     // ADPS - Prescaler Selection. ADEN - enables ADC.
-    ADCSRA = H(ADPS2) | H(ADPS1) | H(ADPS0) | H(ADEN);
+    // ADATE - auto trigger, with ADTS bits in ADCSRB being zero it means free running mode.
+    // ADIE - conversions are taken by ISR(ADC_vect).
+    // Free running mode and the interrupt give us fixed sampling rate no matter how busy the main loop is.
+    ADCSRA = H(ADPS2) | H(ADPS1) | H(ADPS0) | H(ADEN) | H(ADATE) | H(ADIE);
+
+    // Immediately start AD-conversion for PH-Meter
+    ADCSRA |= H(ADSC);
+};
+
+X_INIT$(init_ph_dither) {
+    if (AK_PH_DITHER_ENABLED) {
+        DDRH |= H(PH6);
+
+        // Fast PWM, non-inverting output on OC2B, no prescaler (62.5khz PWM)
+        TCCR2A = H(COM2B1) | H(WGM21) | H(WGM20);
+        TCCR2B = H(CS20);
+    } else {
+        // Same as unused pin: input with pull up
+        PORTH |= H(PH6);
+    }
+}
+
+// Batch of decimated samples
+typedef struct {
+    u32 tick;         // Value of uptime_deciseconds when batch is closed
+    u32 accum;        // Sum of decimated samples
+    u16 samples;      // Number of decimated samples
+    u16 bad_samples;  // Number of bad raw samples (outside of allowed interval)
+} PhAdcBatch;
+
+GLOBAL$() {
+    // Current oversampling window (used only by ISR)
+    STATIC_VAR$(u24 ph_adc_oversampling_accum);
+    STATIC_VAR$(u16 ph_adc_oversampling_samples);
+    STATIC_VAR$(u8 ph_adc_oversampling_has_bad_samples);
+
+    // Decimated samples of the current decisecond (written by ISR, taken by ph_adc_ticker with interrupts disabled)
+    STATIC_VAR$(volatile u32 ph_adc_decisecond_accum);
+    STATIC_VAR$(volatile u16 ph_adc_decisecond_samples);
+    STATIC_VAR$(volatile u16 ph_adc_decisecond_bad_samples);
+
+    // Decimated samples of the last complete decisecond (used by ph_ticker)
+    STATIC_VAR$(u32 ph_adc_last_decisecond_accum);
+    STATIC_VAR$(u16 ph_adc_last_decisecond_samples);
+    STATIC_VAR$(u16 ph_adc_last_decisecond_bad_samples);
+
+    // Batch that is being collected and FIFO of closed batches
+    STATIC_VAR$(PhAdcBatch ph_adc_batch, initial = {});
+    STATIC_VAR$(u8 ph_adc_batch_deciseconds);
+    STATIC_VAR$(PhAdcBatch ph_adc_batch_fifo[AK_PH_BATCH_FIFO_SIZE], initial = {});
+    STATIC_VAR$(u8 ph_adc_batch_fifo_next_empty_idx);
+    STATIC_VAR$(u8 ph_adc_batch_fifo_next_read_idx);
+    STATIC_VAR$(u8 ph_adc_batch_fifo_overflow_count);
+};
+
+// Conversion is complete (ADC is free running and already converts the next one).
+// ADIF is cleared by hardware when the interrupt is taken.
+ISR(ADC_vect) {
+    u16 current_adc = ADC;
+
+    // Add current value into oversampling accumulator.
+    // A window with a bad sample is useless, but we still have to wait until
+    // it ends in order to keep decimated samples evenly spaced.
+    if (current_adc < AK_PH_SENSOR_MIN_ADC || current_adc > AK_PH_SENSOR_MAX_ADC) {
+        ph_adc_decisecond_bad_samples += 1;
+        ph_adc_oversampling_has_bad_samples = AKAT_ONE;
+    } else {
+        ph_adc_oversampling_accum += current_adc;
+    }
+
+    ph_adc_oversampling_samples += 1;
+
+    if (ph_adc_oversampling_samples == AK_PH_OVERSAMPLING_SAMPLES) {
+        // Decimation
+        if (ph_adc_oversampling_has_bad_samples) {
+            capture_sample(AK_CAPTURE_INVALID_SAMPLE);
+        } else {
+            const u16 decimated = ph_adc_oversampling_accum >> AK_PH_OVERSAMPLING_BITS;
+            ph_adc_decisecond_accum += decimated;
+            ph_adc_decisecond_samples += 1;
+            capture_sample(decimated);
+        }
+
+        ph_adc_oversampling_accum = 0;
+        ph_adc_oversampling_samples = 0;
+        ph_adc_oversampling_has_bad_samples = 0;
+    }
+
+    if (AK_PH_DITHER_ENABLED) {
+        // Triangle 0..255..0 with one period per decimation window
+        const u16 phase = (u16)((u32)ph_adc_oversampling_samples * 512 / AK_PH_OVERSAMPLING_SAMPLES);
+        OCR2B = phase < 256 ? phase : 511 - phase;
+    }
+}
+
+// Batch boundaries are aligned to decisecond ticks, so batches are evenly spaced
+// no matter how fast usart0_writer is.
+X_EVERY_DECISECOND$(ph_adc_ticker) {
+    cli();
+    ph_adc_last_decisecond_accum = ph_adc_decisecond_accum;
+    ph_adc_last_decisecond_samples = ph_adc_decisecond_samples;
+    ph_adc_last_decisecond_bad_samples = ph_adc_decisecond_bad_samples;
+
+    ph_adc_decisecond_accum = 0;
+    ph_adc_decisecond_samples = 0;
+    ph_adc_decisecond_bad_samples = 0;
+    sei();
+
+    ph_adc_batch.accum += ph_adc_last_decisecond_accum;
+    ph_adc_batch.samples += ph_adc_last_decisecond_samples;
+    ph_adc_batch.bad_samples += ph_adc_last_decisecond_bad_samples;
+
+    ph_adc_batch_deciseconds += 1;
+    if (ph_adc_batch_deciseconds < AK_PH_BATCH_DECISECONDS) {
+        return;
+    }
+
+    // Close the batch
+    ph_adc_batch.tick = uptime_deciseconds;
+
+    u8 new_next_empty_idx = (ph_adc_batch_fifo_next_empty_idx + AKAT_ONE) & (AK_PH_BATCH_FIFO_SIZE - 1);
+    if (new_next_empty_idx == ph_adc_batch_fifo_next_read_idx) {
+        TRACE_PH_BATCH_DROPPED(ph_adc_batch.tick);
+
+        ph_adc_batch_fifo_overflow_count += AKAT_ONE;
+        // Don't let it overflow!
+        if (!ph_adc_batch_fifo_overflow_count) {
+            ph_adc_batch_fifo_overflow_count -= AKAT_ONE;
+        }
+    } else {
+        ph_adc_batch_fifo[ph_adc_batch_fifo_next_empty_idx] = ph_adc_batch;
+        ph_adc_batch_fifo_next_empty_idx = new_next_empty_idx;
+    }
+
+    // Start a new one
+    ph_adc_batch.accum = 0;
+    ph_adc_batch.samples = 0;
+    ph_adc_batch.bad_samples = 0;
+    ph_adc_batch_deciseconds = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+// PH
+
+// Two-point calibration as uploaded by host and stored in EEPROM.
+// AVR is little-endian and doesn't pad structures, so it's exactly what host uploads
+// (it's packed for the native build, see host/sim.c).
+typedef struct __attribute__((packed)) {
+    u16 ph1_milli;       // PH of the first calibration solution multiplied by 1000
+    u16 adc1;            // Decimated ADC value (14 bits) for the first calibration solution
+    u16 ph2_milli;       // PH of the second calibration solution multiplied by 1000
+    u16 adc2;            // Decimated ADC value (14 bits) for the second calibration solution
+    u16 temperatureX16;  // Temperature of calibration solutions (celsius multiplied by 16)
+    u16 safety_min_milli_ph;         // CO2 is locked out below this PH (multiplied by 1000)
+    u16 safety_hysteresis_milli_ph;  // Lockout is released above the limit plus this (multiplied by 1000)
+} PhCalibration;
+
+_Static_assert(sizeof(PhCalibration) == 14, "PhCalibration must not be padded");
+
+static PhCalibration EEMEM ph_calibration_eeprom;
+static u8 EEMEM ph_calibration_eeprom_crc;
+
+GLOBAL$() {
+    // Calibration in a form that is suitable for fixed point calculations
+    STATIC_VAR$(u8 ph_calibration_valid);
+    STATIC_VAR$(u8 ph_calibration_crc);
+    STATIC_VAR$(i32 ph_slope_q20);             // PH per decimated ADC unit at calibration temperature (Q20)
+    STATIC_VAR$(i32 ph_isopotential_adc);      // Decimated ADC value at PH 7 where temperature doesn't matter
+    STATIC_VAR$(u16 ph_calibration_kelvinX16);
+    STATIC_VAR$(u16 ph_safety_min_milli_ph);
+    STATIC_VAR$(u16 ph_safety_release_milli_ph);
+
+    // Slope compensated for the current temperature (Q20)
+    STATIC_VAR$(i32 ph_compensated_slope_q20);
+
+    // Temperature compensated PH in Q16 fixed point format. Zero means unknown.
+    STATIC_VAR$(u32 ph_q16);
+    STATIC_VAR$(u16 ph_compensation_temperatureX16);
+    STATIC_VAR$(u8 ph_safety_deciseconds);
+}
+
+// Two points with the same PH or the same ADC value don't define a line.
+// Safety limit plus hysteresis must be a PH.
+FUNCTION$(u8 is_valid_ph_calibration(const PhCalibration * const c)) {
+    return c->ph1_milli != c->ph2_milli && c->adc1 != c->adc2
+           && (u32)c->safety_min_milli_ph + c->safety_hysteresis_milli_ph <= 14000;
+}
+
+FUNCTION$(void apply_ph_calibration(const PhCalibration * const c, const u8 crc)) {
+    if (!is_valid_ph_calibration(c)) {
+        ph_calibration_valid = 0;
+        return;
+    }
+
+    const i16 dph_milli = (i16)c->ph2_milli - (i16)c->ph1_milli;
+    const i16 dadc = (i16)c->adc2 - (i16)c->adc1;
+
+    // Q16 milli-PH per ADC unit first (to keep precision), then Q20 PH per ADC unit
+    ph_slope_q20 = ((i32)dph_milli * 65536L / dadc) * 16L / 1000L;
+    ph_isopotential_adc = (i32)c->adc1 + (7000L - (i32)c->ph1_milli) * dadc / dph_milli;
+    ph_calibration_kelvinX16 = c->temperatureX16 + AK_ZERO_CELSIUS_IN_KELVIN_X16;
+    ph_safety_min_milli_ph = c->safety_min_milli_ph;
+    ph_safety_release_milli_ph = c->safety_min_milli_ph + c->safety_hysteresis_milli_ph;
+    ph_calibration_crc = crc;
+    ph_calibration_valid = AKAT_ONE;
+}
+
+X_INIT$(load_ph_calibration) {
+    PhCalibration c;
+    eeprom_read_block(&c, &ph_calibration_eeprom, sizeof(PhCalibration));
+
+    const u8 crc = eeprom_read_byte(&ph_calibration_eeprom_crc);
+    if (akat_crc_add_bytes(0, (const u8 *)&c, sizeof(PhCalibration)) == crc) {
+        apply_ph_calibration(&c, crc);
+    }
+}
+
+// Called when host commits PhCalibrationUpload
+FUNCTION$(void commit_ph_calibration_upload()) {
+    // Degenerate calibration is rejected before it gets into EEPROM, so the current one stays in use
+    if (!is_valid_upload(sizeof(PhCalibration)) || !is_valid_ph_calibration((const PhCalibration *)upload_buf)) {
+        count_upload_error(PhCalibrationUpload);
+        return;
+    }
+
+    const u8 crc = upload_buf[sizeof(PhCalibration)];
+
+    // Update writes only bytes that are changed
+    eeprom_update_block(upload_buf, &ph_calibration_eeprom, sizeof(PhCalibration));
+    eeprom_update_byte(&ph_calibration_eeprom_crc, crc);
+
+    apply_ph_calibration((const PhCalibration *)upload_buf, crc);
+}
+
+// Converts average decimated ADC value (Q4) into PH (Q16) using compensated slope. Returns zero if unknown.
+// Slope of the electrode is proportional to absolute temperature, while the
+// isopotential point (PH 7) doesn't depend on temperature, so:
+//    ph = 7 + (adc - adc7) * slope * Tcal / T
+FUNCTION$(u32 calc_ph_q16(const i32 adc_q4)) {
+    if (!ph_calibration_valid) {
+        return 0;
+    }
+
+    // Q4 * Q20 = Q24, that's why we divide by 256
+    i32 ph = 7L * 65536L + (adc_q4 - ph_isopotential_adc * 16L) * ph_compensated_slope_q20 / 256L;
+
+    if (ph < 1) {
+        return 1; // zero means unknown
+    }
+
+    if (ph > 14L * 65536L) {
+        return 14L * 65536L;
+    }
+
+    return ph;
+}
+
+// Calculates PH from decimated samples of the last decisecond.
+X_EVERY_DECISECOND$(ph_ticker) {
+    const u32 accum = ph_adc_last_decisecond_accum;
+    const u16 samples = ph_adc_last_decisecond_samples;
+
+    if (!ph_calibration_valid) {
+        ph_q16 = 0;
+        return;
+    }
+
+    // Temperature
+    if (ds18b20_aqua.get_updated_deciseconds_ago() < AK_PH_MAX_TEMPERATURE_AGE_DECISECONDS) {
+        ph_compensation_temperatureX16 = ds18b20_aqua.get_temperatureX16();
+    } else {
+        ph_compensation_temperatureX16 = ph_calibration_kelvinX16 - AK_ZERO_CELSIUS_IN_KELVIN_X16;
+    }
+
+    const u16 kelvinX16 = ph_compensation_temperatureX16 + AK_ZERO_CELSIUS_IN_KELVIN_X16;
+    ph_compensated_slope_q20 = ph_slope_q20 * ph_calibration_kelvinX16 / kelvinX16;
+
+    if (!samples) {
+        ph_q16 = 0;
+        return;
+    }
+
+    // Average ADC in Q4 (we have 14 bits, so it fits)
+    const i32 ph = calc_ph_q16((i32)(accum * 16 / samples));
+
+    ph_q16 = ph;
+
+    // Safety
+    const u16 ph_milli = (u16)((ph * 1000L) >> 16);
+
+    const u8 unsafe = ph_safety_co2_lockout
+                      ? (ph_milli < ph_safety_release_milli_ph)
+                      : (ph_milli < ph_safety_min_milli_ph);
+
+    if (unsafe == ph_safety_co2_lockout) {
+        // Nothing to change
+        ph_safety_deciseconds = 0;
+    } else {
+        ph_safety_deciseconds += 1;
+        if (ph_safety_deciseconds >= AK_PH_SAFETY_DECISECONDS) {
+            ph_safety_co2_lockout = unsafe;
+            ph_safety_deciseconds = 0;
+            TRACE_PH_SAFETY_LOCKOUT(unsafe, ph_milli);
+        }
+    }
+}
+
+// - - - - - - - - - - - -  - - - - - - - ---- - - -- - - - -  - - - -
+// Sliding windows
+
+// Marks seconds without good samples in the ring buffer
+#define AK_PH_WINDOW_INVALID  0xFFFF
+
+GLOBAL$() {
+    // Means of decimated samples for every second in Q2 (14 bits + 2 bits fits into u16).
+    // It's initialized with AK_PH_WINDOW_INVALID by init_ph_window.
+    STATIC_VAR$(u16 ph_window[AK_PH_WINDOW_LONG_SECONDS], initial = {});
+    STATIC_VAR$(u16 ph_window_next_idx);
+
+    // Running sums of valid seconds, they are updated when second enters or leaves a window
+    STATIC_VAR$(u32 ph_window_short_sum);
+    STATIC_VAR$(u16 ph_window_short_seconds);
+    STATIC_VAR$(u32 ph_window_long_sum);
+    STATIC_VAR$(u16 ph_window_long_seconds);
+
+    // Current second
+    STATIC_VAR$(u32 ph_second_accum);
+    STATIC_VAR$(u16 ph_second_samples);
+    STATIC_VAR$(u8 ph_second_deciseconds);
+    STATIC_VAR$(u8 ph_second_has_bad_samples);
+    STATIC_VAR$(u8 ph_window_skip_next_second);
+
+    // Averages (Q16), zero if less than half of the window is valid or there is no calibration
+    STATIC_VAR$(u32 ph_short_window_q16);
+    STATIC_VAR$(u32 ph_long_window_q16);
+}
+
+X_INIT$(init_ph_window) {
+    for (u16 i = 0; i < AK_PH_WINDOW_LONG_SECONDS; i++) {
+        ph_window[i] = AK_PH_WINDOW_INVALID;
+    }
+}
+
+X_EVERY_DECISECOND$(ph_window_ticker) {
+    ph_second_accum += ph_adc_last_decisecond_accum;
+    ph_second_samples += ph_adc_last_decisecond_samples;
+    if (ph_adc_last_decisecond_bad_samples) {
+        ph_second_has_bad_samples = AKAT_ONE;
+    }
+
+    ph_second_deciseconds += 1;
+    if (ph_second_deciseconds < 10) {
+        return;
+    }
+
+    u16 mean_q2 = AK_PH_WINDOW_INVALID;
+
+    if (ph_second_has_bad_samples) {
+        // Noise that caused bad samples probably affected adjacent seconds too,
+        // so we invalidate the previous second and skip the next one.
+        const u16 prev_idx = (ph_window_next_idx ? ph_window_next_idx : AK_PH_WINDOW_LONG_SECONDS) - 1;
+        const u16 prev_mean_q2 = ph_window[prev_idx];
+
+        if (prev_mean_q2 != AK_PH_WINDOW_INVALID) {
+            // The previous second is in both windows
+            ph_window_short_sum -= prev_mean_q2;
+            ph_window_short_seconds -= 1;
+            ph_window_long_sum -= prev_mean_q2;
+            ph_window_long_seconds -= 1;
+            ph_window[prev_idx] = AK_PH_WINDOW_INVALID;
+        }
+
+        ph_window_skip_next_second = AKAT_ONE;
+    } else if (ph_window_skip_next_second) {
+        ph_window_skip_next_second = 0;
+    } else if (ph_second_samples) {
+        mean_q2 = (u16)(ph_second_accum * 4 / ph_second_samples);
+    }
+
+    ph_second_accum = 0;
+    ph_second_samples = 0;
+    ph_second_deciseconds = 0;
+    ph_second_has_bad_samples = 0;
+
+    // The oldest second leaves the long window (its place is taken by the new one)
+    const u16 long_tail_mean_q2 = ph_window[ph_window_next_idx];
+    if (long_tail_mean_q2 != AK_PH_WINDOW_INVALID) {
+        ph_window_long_sum -= long_tail_mean_q2;
+        ph_window_long_seconds -= 1;
+    }
+
+    // The second that is AK_PH_WINDOW_SHORT_SECONDS old leaves the short window
+    const u16 short_tail_idx = ph_window_next_idx >= AK_PH_WINDOW_SHORT_SECONDS
+                               ? ph_window_next_idx - AK_PH_WINDOW_SHORT_SECONDS
+                               : ph_window_next_idx + (AK_PH_WINDOW_LONG_SECONDS - AK_PH_WINDOW_SHORT_SECONDS);
+
+    const u16 short_tail_mean_q2 = ph_window[short_tail_idx];
+    if (short_tail_mean_q2 != AK_PH_WINDOW_INVALID) {
+        ph_window_short_sum -= short_tail_mean_q2;
+        ph_window_short_seconds -= 1;
+    }
+
+    // The new second enters both windows
+    ph_window[ph_window_next_idx] = mean_q2;
+    if (mean_q2 != AK_PH_WINDOW_INVALID) {
+        ph_window_short_sum += mean_q2;
+        ph_window_short_seconds += 1;
+        ph_window_long_sum += mean_q2;
+        ph_window_long_seconds += 1;
+    }
+
+    ph_window_next_idx += 1;
+    if (ph_window_next_idx == AK_PH_WINDOW_LONG_SECONDS) {
+        ph_window_next_idx = 0;
+    }
+
+    // Averages in Q4 (sums are in Q2)
+    ph_short_window_q16 = ph_window_short_seconds >= AK_PH_WINDOW_SHORT_SECONDS / 2
+                          ? calc_ph_q16((i32)(ph_window_short_sum * 4 / ph_window_short_seconds))
+                          : 0;
+
+    ph_long_window_q16 = ph_window_long_seconds >= AK_PH_WINDOW_LONG_SECONDS / 2
+                         ? calc_ph_q16((i32)(ph_window_long_sum * 4 / ph_window_long_seconds))
+                         : 0;
+}
+
+// - - - - - - - - - - - -  - - - - - - - ---- - - -- - - - -  - - - -
+// CO2 curve
+
+// Host's CO2 controller keeps PH between the min-PH curve and the curve plus margin.
+// Host uploads the curve, so we can do the same when host is gone (Co2CurveFallback)
+// or all the time (Co2CurveContinuous), while host only supervises.
+// Curve is the same as on host (see calcMinPh):
+//    before day start: min_ph = a * e ^ (100 / hour) + b
+//    since day start:  min_ph = c * e ^ (hour / 2) + d
+// It's evaluated once per minute (exp() is too slow for every decisecond), hysteresis is done
+// with fixed point PH of the last decisecond.
+
+// Host uploads exactly this (float is IEEE 754 single precision, little-endian)
+typedef struct __attribute__((packed)) {
+    u8 mode;                // Co2CurveMode
+    float a;
+    float b;
+    float c;
+    float d;
+    u16 prepare_minute;     // Curve is defined from prepare_minute till end_minute (inclusive)
+    u16 start_minute;
+    u16 end_minute;
+    u16 margin_milli_ph;    // CO2 is turned on at min_ph + margin
+} Co2Curve;
+
+_Static_assert(sizeof(Co2Curve) == 25, "Co2Curve must not be padded");
+
+static Co2Curve EEMEM co2_curve_eeprom;
+static u8 EEMEM co2_curve_eeprom_crc;
+
+GLOBAL$() {
+    STATIC_VAR$(Co2Curve co2_curve, initial = {});
+    STATIC_VAR$(u8 co2_curve_crc);
+
+    // Min PH of the current minute, zero if curve is not defined (i.e. no CO2)
+    STATIC_VAR$(u16 co2_curve_min_milli_ph);
+    STATIC_VAR$(u16 co2_curve_minute, initial = 0xFFFF);
+    STATIC_VAR$(u8 co2_curve_deciseconds);
+}
+
+FUNCTION$(u8 is_valid_co2_curve(const Co2Curve * const c)) {
+    return c->mode <= Co2CurveContinuous
+           && c->prepare_minute
+           && c->prepare_minute <= c->start_minute
+           && c->start_minute <= c->end_minute
+           && c->end_minute < 24 * 60
+           && c->margin_milli_ph;
+}
+
+FUNCTION$(void apply_co2_curve(const Co2Curve * const c, const u8 crc)) {
+    co2_curve = *c;
+    co2_curve_crc = crc;
+    co2_curve_mode = c->mode;
+
+    // Recalculate and start hysteresis from scratch
+    co2_curve_minute = 0xFFFF;
+    co2_curve_deciseconds = 0;
+}
+
+X_INIT$(load_co2_curve) {
+    Co2Curve c;
+    eeprom_read_block(&c, &co2_curve_eeprom, sizeof(Co2Curve));
+
+    const u8 crc = eeprom_read_byte(&co2_curve_eeprom_crc);
+    if (akat_crc_add_bytes(0, (const u8 *)&c, sizeof(Co2Curve)) == crc && is_valid_co2_curve(&c)) {
+        apply_co2_curve(&c, crc);
+    }
+}
+
+// Called when host commits Co2CurveUpload
+FUNCTION$(void commit_co2_curve_upload()) {
+    const Co2Curve * const c = (const Co2Curve *)upload_buf;
+
+    if (!is_valid_upload(sizeof(Co2Curve)) || !is_valid_co2_curve(c)) {
+        count_upload_error(Co2CurveUpload);
+        return;
+    }
+
+    const u8 crc = upload_buf[sizeof(Co2Curve)];
+
+    eeprom_update_block(c, &co2_curve_eeprom, sizeof(Co2Curve));
+    eeprom_update_byte(&co2_curve_eeprom_crc, crc);
+
+    apply_co2_curve(c, crc);
+}
 
-    // Immediately start AD-conversion for PH-Meter
-    ADCSRA |= H(ADSC);
-};
+FUNCTION$(u16 calc_co2_curve_min_milli_ph(const u16 minute)) {
+    const Co2Curve * const c = &co2_curve;
+
+    if (minute < c->prepare_minute || minute > c->end_minute) {
+        return 0;
+    }
+
+    const float hour = minute / 60.0f;
+    const float ph = minute < c->start_minute
+                     ? c->a * expf(100.0f / hour) + c->b
+                     : c->c * expf(hour / 2.0f) + c->d;
+
+    // Also catches NaN
+    if (!(ph >= 1.0f && ph <= 14.0f)) {
+        return 0;
+    }
+
+    return (u16)(ph * 1000.0f + 0.5f);
+}
+
+// Runs after 'ph_ticker', so it uses PH of the last decisecond
+X_EVERY_DECISECOND$(co2_curve_ticker) {
+    if (co2_curve_mode == Co2CurveDisabled) {
+        co2_curve_required_state = 0;
+        return;
+    }
+
+    const u16 minute = clock_deciseconds_since_midnight / 600;
+    if (minute != co2_curve_minute) {
+        co2_curve_minute = minute;
+        co2_curve_min_milli_ph = calc_co2_curve_min_milli_ph(minute);
+    }
+
+    if (!co2_curve_min_milli_ph || !ph_q16) {
+        co2_curve_required_state = 0;
+        co2_curve_deciseconds = 0;
+        return;
+    }
+
+    const u16 ph_milli = (u16)((ph_q16 * 1000L) >> 16);
+
+    // Valve is closed at the curve and opened at the curve plus margin
+    const u8 required = co2_curve_required_state
+                        ? (ph_milli > co2_curve_min_milli_ph)
+                        : (ph_milli >= co2_curve_min_milli_ph + co2_curve.margin_milli_ph);
+
+    if (required == co2_curve_required_state) {
+        co2_curve_deciseconds = 0;
+    } else {
+        co2_curve_deciseconds += 1;
+        if (co2_curve_deciseconds >= AK_CO2_CURVE_DECISECONDS) {
+            co2_curve_required_state = required;
+            co2_curve_deciseconds = 0;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+// CO2 NN config
+
+// Inputs of the prediction network (see 'CO2 NN') that depend on the aquarium,
+// host uploads them from its config (the same values PhPredictionWorkerThread.ts uses)
+typedef struct __attribute__((packed)) {
+    u8 instance_feature;    // 1 for the first aquarium (instanceId == 1), 0 otherwise
+} Co2nnConfig;
+
+static Co2nnConfig EEMEM co2nn_config_eeprom;
+static u8 EEMEM co2nn_config_eeprom_crc;
 
 GLOBAL$() {
-    STATIC_VAR$(u24 ph_adc_accum);
-    STATIC_VAR$(u16 ph_adc_accum_samples);
-    STATIC_VAR$(u16 ph_adc_bad_samples);
-};
+    // There are no predictions until host uploads the config
+    STATIC_VAR$(u8 co2nn_config_valid);
+    STATIC_VAR$(Co2nnConfig co2nn_config, initial = {});
+    STATIC_VAR$(u8 co2nn_config_crc);
+}
 
-RUNNABLE$(adc_runnable) {
-    if (!(ADCSRA & H(ADSC))) {
-        // No conversions are in progress now, read current value and start a new conversion
+FUNCTION$(u8 is_valid_co2nn_config(const Co2nnConfig * const c)) {
+    return c->instance_feature <= 1;
+}
 
-        // First store current value into a temporary variable
-        u16 current_adc = ADC;
+FUNCTION$(void apply_co2nn_config(const Co2nnConfig * const c, const u8 crc)) {
+    co2nn_config = *c;
+    co2nn_config_crc = crc;
+    co2nn_config_valid = AKAT_ONE;
+}
 
-        // Start new conversion
-        ADCSRA |= H(ADSC);
+X_INIT$(load_co2nn_config) {
+    Co2nnConfig c;
+    eeprom_read_block(&c, &co2nn_config_eeprom, sizeof(Co2nnConfig));
 
-        // Add current value into accumulator
-        if (current_adc < AK_PH_SENSOR_MIN_ADC || current_adc > AK_PH_SENSOR_MAX_ADC) {
-            ph_adc_bad_samples += 1;
-        } else {
-            ph_adc_accum += current_adc;
-            ph_adc_accum_samples += 1;
+    const u8 crc = eeprom_read_byte(&co2nn_config_eeprom_crc);
+    if (akat_crc_add_bytes(0, (const u8 *)&c, sizeof(Co2nnConfig)) == crc && is_valid_co2nn_config(&c)) {
+        apply_co2nn_config(&c, crc);
+    }
+}
+
+// Called when host commits Co2nnConfigUpload
+FUNCTION$(void commit_co2nn_config_upload()) {
+    const Co2nnConfig * const c = (const Co2nnConfig *)upload_buf;
+
+    if (!is_valid_upload(sizeof(Co2nnConfig)) || !is_valid_co2nn_config(c)) {
+        count_upload_error(Co2nnConfigUpload);
+        return;
+    }
+
+    const u8 crc = upload_buf[sizeof(Co2nnConfig)];
+
+    eeprom_update_block(c, &co2nn_config_eeprom, sizeof(Co2nnConfig));
+    eeprom_update_byte(&co2nn_config_eeprom_crc, crc);
+
+    apply_co2nn_config(c, crc);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+// Upload commits
+
+// Called from uart-command-receiver if 'V' command is received
+FUNCTION$(void commit_upload(const u8 target)) {
+    switch (target) {
+    case PhCalibrationUpload:
+        commit_ph_calibration_upload();
+        break;
+
+    case ScheduleProfileUpload:
+        commit_schedule_profile_upload();
+        break;
+
+    case Co2CurveUpload:
+        commit_co2_curve_upload();
+        break;
+
+    case Co2nnConfigUpload:
+        commit_co2nn_config_upload();
+        break;
+
+    default:
+        count_upload_error(target);
+        break;
+    }
+
+    upload_size = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+// Time sync
+
+// NTP-like exchange: host sends <Tseq Tseq>, we stamp reception of 'T' byte in USART0 ISR
+// and usart0_writer stamps transmission of the reply (see '=' in protocol.json). Stamps are
+// Timer1 periods and ticks (TCNT1), host uses them to calculate offset and round-trip time.
+// Host then aligns our decisecond boundaries to its clock with 'P' command (see 'clock_trim_ticker')
+// and sends clock that is correct at the moment it's applied.
+
+GLOBAL$() {
+    // Result of 'take_timer1_timestamp'
+    STATIC_VAR$(volatile u32 timer1_timestamp_periods);
+    STATIC_VAR$(volatile u16 timer1_timestamp_ticks);
+
+    // Time when the last 'T' byte was received
+    STATIC_VAR$(volatile u32 time_sync_rx_periods);
+    STATIC_VAR$(volatile u16 time_sync_rx_ticks);
+
+    // Reply to be sent by usart0_writer, sequence number zero means there is nothing to send
+    STATIC_VAR$(u8 time_sync_seq);
+    STATIC_VAR$(u32 time_sync_reply_rx_periods);
+    STATIC_VAR$(u16 time_sync_reply_rx_ticks);
+    STATIC_VAR$(u32 time_sync_tx_clock);
+}
+
+// Must be called with interrupts disabled!
+// Timer1 might have already reached its top while X_EVERY_DECISECOND$ handlers haven't run yet:
+// either compare match is not serviced yet or AKAT has only set its flag (see TIMER1_COMPA_vect).
+FUNCTION$(void take_timer1_timestamp()) {
+    const u16 ticks = TCNT1;
+    u32 periods = timer1_periods;
+
+    if (akat_every_decisecond_run_required) {
+        periods += 1;
+    }
+
+    // Counter has wrapped after we read it if ticks is large, so check ticks as well
+    if ((TIFR1 & H(OCF1A)) && ticks < AK_TIMER1_NOMINAL_TOP / 2) {
+        periods += 1;
+    }
+
+    timer1_timestamp_periods = periods;
+    timer1_timestamp_ticks = ticks;
+}
+
+// USART0_RX_vect jumps here (with registers it used restored) when it has received 'T', so this is an ISR
+// of its own: it saves what it uses and returns with reti. It's not in the vector table, the name only
+// makes gcc take it for an ISR without warnings.
+ISR(__vector_usart0_rx_time_sync) {
+    take_timer1_timestamp();
+    time_sync_rx_periods = timer1_timestamp_periods;
+    time_sync_rx_ticks = timer1_timestamp_ticks;
+}
+
+// Called from usart0_reader when 'T' command is received.
+// The second 'T' byte of the command is the one that is stamped.
+FUNCTION$(void request_time_sync(const u8 seq)) {
+    cli();
+    time_sync_reply_rx_periods = time_sync_rx_periods;
+    time_sync_reply_rx_ticks = time_sync_rx_ticks;
+    sei();
+
+    time_sync_seq = seq;
+}
+
+// Called from usart0_writer right before the first byte of reply is written, returns stamp in timer1_timestamp_*.
+// Clock is reported for the same moment, i.e. it's adjusted for not yet handled deciseconds.
+FUNCTION$(void take_time_sync_tx_stamp()) {
+    cli();
+    take_timer1_timestamp();
+    time_sync_tx_clock = clock_deciseconds_since_midnight + (timer1_timestamp_periods - timer1_periods);
+    sei();
+
+    if (time_sync_tx_clock >= AK_NUMBER_DECISECONDS_IN_DAY) {
+        time_sync_tx_clock -= AK_NUMBER_DECISECONDS_IN_DAY;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+// CO2 NN
+
+// Min-PH prediction network (the same one host runs with TensorFlow, see PhPredictionWorkerThread.ts)
+// quantized by src/co2nn/export_avr.py. We keep history of 15-second samples of the last 15 minutes
+// and predict min PH after CO2 valve is closed: at the moment it's closed and every 15 seconds while
+// it's open (as if it's closed right now, host's CO2 controller uses them). Fixed point format is
+// described in export_avr.py.
+//
+// Inference is ~15.5k multiply-accumulates, so it runs in co2nn_thread that yields after every
+// AK_CO2NN_MACS_PER_SLICE of them (57 slices), main loop is never blocked for more than one slice
+// (a slice ends after a whole neuron, so it's at most ~400 MACs).
+
+#include "co2nn_model.h"
+
+// History sample period (the same as on host)
+#define AK_CO2NN_SAMPLE_DECISECONDS  150
+
+#define AK_CO2NN_FLAG_DAY_LIGHT  1
+#define AK_CO2NN_FLAG_CO2  2
+
+#define AK_CO2NN_ONE  (1 << CO2NN_ACTIVATION_BITS)
+
+// Slice of inference between yields, a MAC is ~25 cycles (pgm_read and 32-bit multiplication)
+#define AK_CO2NN_MACS_PER_SLICE  256
+
+// Number of chunks Conv1D layers are applied to (their kernel_size == strides)
+#define AK_CO2NN_L1_STEPS  (CO2NN_WINDOW_LENGTH * CO2NN_L0CCONV_OUTPUTS / CO2NN_L1CONV_INPUTS)
+#define AK_CO2NN_L2_STEPS  (AK_CO2NN_L1_STEPS * CO2NN_L1CONV_OUTPUTS / CO2NN_L2CONV_INPUTS)
+
+// Layers are computed by ping-ponging between two buffers
+#define AK_CO2NN_BUF_A_SIZE  (AK_CO2NN_L1_STEPS * CO2NN_L1CONV_OUTPUTS)
+#define AK_CO2NN_BUF_B_SIZE  CO2NN_L3FC_INPUTS
+
+#if CO2NN_WINDOW_LENGTH * CO2NN_L0CCONV_OUTPUTS > AK_CO2NN_BUF_B_SIZE \
+    || AK_CO2NN_L2_STEPS * CO2NN_L2CONV_OUTPUTS != CO2NN_L3FC_INPUTS
+#error "Unexpected CO2 NN shape, check co2nn_thread"
+#endif
+
+GLOBAL$() {
+    // Ring buffer of samples, PH is zero if it's unknown
+    STATIC_VAR$(u16 co2nn_history_ph60_milli[CO2NN_WINDOW_LENGTH], initial = {});
+    STATIC_VAR$(u8 co2nn_history_flags[CO2NN_WINDOW_LENGTH], initial = {});
+    STATIC_VAR$(u8 co2nn_history_next_idx);
+    STATIC_VAR$(u8 co2nn_sample_deciseconds);
+    STATIC_VAR$(u8 co2nn_valve_open);
+
+    STATIC_VAR$(i16 co2nn_buf_a[AK_CO2NN_BUF_A_SIZE], initial = {});
+    STATIC_VAR$(i16 co2nn_buf_b[AK_CO2NN_BUF_B_SIZE], initial = {});
+
+    // Set by co2nn_ticker, co2nn_thread takes the request when it starts a prediction
+    STATIC_VAR$(u8 co2nn_requested);
+    STATIC_VAR$(u8 co2nn_requested_on_close);
+
+    // Timer1 stamp of the start of the current slice and cycles of the finished ones
+    STATIC_VAR$(u32 co2nn_slice_start_periods);
+    STATIC_VAR$(u16 co2nn_slice_start_ticks);
+    STATIC_VAR$(u32 co2nn_slices_cycles);
+
+    // The last prediction, id is incremented with every new one (it's zero until the first one).
+    // Cycles are the sum of cycles of its slices, i.e. it doesn't include time other code ran between them.
+    STATIC_VAR$(u8 co2nn_prediction_id);
+    STATIC_VAR$(u16 co2nn_prediction_milli_ph);
+    STATIC_VAR$(u8 co2nn_prediction_on_close);
+    STATIC_VAR$(u32 co2nn_prediction_cycles);
+}
+
+FUNCTION$(i16 co2nn_selu(const i32 x)) {
+    if (x > 0) {
+        // Result is even larger
+        if (x > 32767) {
+            return 32767;
+        }
+
+        return (i16)((x * CO2NN_SELU_SCALE_Q12) >> CO2NN_ACTIVATION_BITS);
+    }
+
+    const u32 d = -x;
+    const u32 i = d >> CO2NN_SELU_TABLE_STEP_BITS;
+    if (i >= CO2NN_SELU_TABLE_SIZE - 1) {
+        return (i16)pgm_read_word(&co2nn_selu_table[CO2NN_SELU_TABLE_SIZE - 1]);
+    }
+
+    const i16 a = (i16)pgm_read_word(&co2nn_selu_table[i]);
+    const i16 b = (i16)pgm_read_word(&co2nn_selu_table[i + 1]);
+    const i32 frac = d & ((1 << CO2NN_SELU_TABLE_STEP_BITS) - 1);
+
+    return a + (i16)(((i32)(b - a) * frac) >> CO2NN_SELU_TABLE_STEP_BITS);
+}
+
+// Layer being applied by co2nn_thread: 'steps' chunks of 'inputs' activations, i.e. it's Conv1D with
+// kernel_size == strides or Dense if steps is 1. Weights are i16 if 'wide' is set, i8 otherwise.
+typedef struct {
+    const i16 *in;
+    i16 *out;
+    u8 steps;
+    u8 inputs;
+    u8 outputs;
+    const void *weights;
+    const i32 *bias;
+    const u8 *shifts;
+    u8 wide;
+} Co2nnLayer;
+
+GLOBAL$() {
+    STATIC_VAR$(Co2nnLayer co2nn_layer, initial = {});
+}
+
+FUNCTION$(void co2nn_set_layer(const i16 *in, i16 *out, const u8 steps, const u8 inputs, const u8 outputs,
+                               const void *weights, const i32 *bias, const u8 *shifts, const u8 wide)) {
+    co2nn_layer.in = in;
+    co2nn_layer.out = out;
+    co2nn_layer.steps = steps;
+    co2nn_layer.inputs = inputs;
+    co2nn_layer.outputs = outputs;
+    co2nn_layer.weights = weights;
+    co2nn_layer.bias = bias;
+    co2nn_layer.shifts = shifts;
+    co2nn_layer.wide = wide;
+}
+
+// Computes output 'f' of a layer for 'inputs' activations
+FUNCTION$(i16 co2nn_neuron(const i16 *in, const u8 inputs, const u8 f,
+                           const void *weights, const i32 *bias, const u8 *shifts, const u8 wide)) {
+    i32 acc = (i32)pgm_read_dword(&bias[f]);
+    const u16 w0 = (u16)f * inputs;
+
+    if (wide) {
+        for (u8 j = 0; j < inputs; j++) {
+            acc += (i32)(i16)pgm_read_word((const i16 *)weights + w0 + j) * in[j];
+        }
+    } else {
+        for (u8 j = 0; j < inputs; j++) {
+            acc += (i32)(i8)pgm_read_byte((const i8 *)weights + w0 + j) * in[j];
+        }
+    }
+
+    const u8 shift = pgm_read_byte(&shifts[f]);
+    return co2nn_selu((acc + (1L << (shift - 1))) >> shift);
+}
+
+// PH features are scaled the same way as scalePh / scalePhOffset do it on host
+FUNCTION$(i16 co2nn_scale_milli_ph(const i32 milli_ph)) {
+    const i32 v = milli_ph * (AK_CO2NN_ONE / 16) / (2000 / 16);
+    return v < 0 ? 0 : (v > AK_CO2NN_ONE ? AK_CO2NN_ONE : (i16)v);
+}
+
+FUNCTION$(void co2nn_add_sample()) {
+    const u8 idx = co2nn_history_next_idx;
+
+    co2nn_history_ph60_milli[idx] = ph_short_window_q16 ? (u16)((ph_short_window_q16 * 1000L) >> 16) : 0;
+    co2nn_history_flags[idx] = (day_light_switch.is_set() ? AK_CO2NN_FLAG_DAY_LIGHT : 0)
+                               | (co2_switch.is_set() ? AK_CO2NN_FLAG_CO2 : 0);
+
+    co2nn_history_next_idx = idx + 1 < CO2NN_WINDOW_LENGTH ? idx + 1 : 0;
+    co2nn_sample_deciseconds = 0;
+}
+
+FUNCTION$(void co2nn_begin_slice()) {
+    cli();
+    take_timer1_timestamp();
+    co2nn_slice_start_periods = timer1_timestamp_periods;
+    co2nn_slice_start_ticks = timer1_timestamp_ticks;
+    sei();
+}
+
+FUNCTION$(void co2nn_end_slice()) {
+    cli();
+    take_timer1_timestamp();
+    const u32 ticks = (timer1_timestamp_periods - co2nn_slice_start_periods) * (AK_TIMER1_NOMINAL_TOP + 1L)
+                      + timer1_timestamp_ticks - co2nn_slice_start_ticks;
+    sei();
+
+    // Timer1 prescaler is 64
+    co2nn_slices_cycles += ticks * 64;
+}
+
+// Returns true if PH is known for every sample of the history
+FUNCTION$(u8 co2nn_has_history()) {
+    for (u8 i = 0; i < CO2NN_WINDOW_LENGTH; i++) {
+        if (!co2nn_history_ph60_milli[i]) {
+            return 0;
+        }
+    }
+
+    return AKAT_ONE;
+}
+
+// Predicts min PH as if CO2 valve is closed right after the last sample.
+// Request is ignored if PH is unknown for any sample or host hasn't uploaded Co2nnConfig yet.
+// History isn't changed while we predict: the next sample comes 15 seconds after the request
+// and it replaces the oldest one which we read first.
+THREAD$(co2nn_thread) {
+    // ---- All variable in the thread must be static (green threads requirement)
+    STATIC_VAR$(u8 on_close);
+    STATIC_VAR$(i32 ph600_milli);
+    STATIC_VAR$(i32 ph_milli);
+    STATIC_VAR$(u8 t);
+    STATIC_VAR$(u8 idx);
+    STATIC_VAR$(u16 slice_macs);
+    STATIC_VAR$(i16 features[CO2NN_FEATURES], initial = {});
+    STATIC_VAR$(i16 l0a[CO2NN_L0ACONV_OUTPUTS], initial = {});
+    STATIC_VAR$(i16 l0b[CO2NN_L0BCONV_OUTPUTS], initial = {});
+
+    STATIC_VAR$(u8 layer_step);
+    STATIC_VAR$(u8 layer_f);
+
+    // ---- Subroutines can yield unlike functions
+
+    // Applies co2nn_layer, yields when the slice is done
+    SUB$(layer) {
+        for (layer_step = 0; layer_step < co2nn_layer.steps; layer_step++) {
+            for (layer_f = 0; layer_f < co2nn_layer.outputs; layer_f++) {
+                *co2nn_layer.out++ = co2nn_neuron(co2nn_layer.in, co2nn_layer.inputs, layer_f, co2nn_layer.weights,
+                                                  co2nn_layer.bias, co2nn_layer.shifts, co2nn_layer.wide);
+
+                slice_macs += co2nn_layer.inputs;
+                if (slice_macs >= AK_CO2NN_MACS_PER_SLICE) {
+                    co2nn_end_slice();
+                    YIELD$();
+                    co2nn_begin_slice();
+                    slice_macs = 0;
+                }
+            }
+
+            co2nn_layer.in += co2nn_layer.inputs;
+        }
+    }
+
+    // - - - - - - - - - - -
+    // Main loop in thread (thread will yield on calls to YIELD$ or WAIT_UNTIL$)
+    while(1) {
+        WAIT_UNTIL$(co2nn_requested);
+
+        on_close = co2nn_requested_on_close;
+        co2nn_requested = 0;
+        co2nn_requested_on_close = 0;
+
+        if (!co2nn_config_valid || !ph_long_window_q16 || !co2nn_has_history()) {
+            continue;
+        }
+
+        ph600_milli = (i32)((ph_long_window_q16 * 1000L) >> 16);
+        co2nn_slices_cycles = 0;
+        slice_macs = 0;
+        co2nn_begin_slice();
+
+        // The first three layers are 1x1 convolutions, so we apply them to every sample (oldest first)
+        idx = co2nn_history_next_idx;
+        for (t = 0; t < CO2NN_WINDOW_LENGTH; t++) {
+            features[0] = co2nn_scale_milli_ph(ph600_milli - 6000);
+            features[1] = co2nn_scale_milli_ph((i32)co2nn_history_ph60_milli[idx] - ph600_milli + 1000);
+            features[2] = (co2nn_history_flags[idx] & AK_CO2NN_FLAG_DAY_LIGHT) ? AK_CO2NN_ONE : 0;
+
+            // Valve is assumed to be closed at the last sample
+            features[3] = ((co2nn_history_flags[idx] & AK_CO2NN_FLAG_CO2) && t + 1 < CO2NN_WINDOW_LENGTH) ? AK_CO2NN_ONE : 0;
+            features[4] = co2nn_config.instance_feature ? AK_CO2NN_ONE : 0;
+
+            idx = idx + 1 < CO2NN_WINDOW_LENGTH ? idx + 1 : 0;
+
+            co2nn_set_layer(features, l0a, 1, CO2NN_L0ACONV_INPUTS, CO2NN_L0ACONV_OUTPUTS,
+                            co2nn_l0aconv_weights, co2nn_l0aconv_bias, co2nn_l0aconv_shifts, AKAT_ONE);
+            CALL$(layer);
+
+            co2nn_set_layer(l0a, l0b, 1, CO2NN_L0BCONV_INPUTS, CO2NN_L0BCONV_OUTPUTS,
+                            co2nn_l0bconv_weights, co2nn_l0bconv_bias, co2nn_l0bconv_shifts, 0);
+            CALL$(layer);
+
+            co2nn_set_layer(l0b, co2nn_buf_b + t * CO2NN_L0CCONV_OUTPUTS, 1, CO2NN_L0CCONV_INPUTS, CO2NN_L0CCONV_OUTPUTS,
+                            co2nn_l0cconv_weights, co2nn_l0cconv_bias, co2nn_l0cconv_shifts, 0);
+            CALL$(layer);
+        }
+
+        co2nn_set_layer(co2nn_buf_b, co2nn_buf_a, AK_CO2NN_L1_STEPS, CO2NN_L1CONV_INPUTS, CO2NN_L1CONV_OUTPUTS,
+                        co2nn_l1conv_weights, co2nn_l1conv_bias, co2nn_l1conv_shifts, 0);
+        CALL$(layer);
+
+        co2nn_set_layer(co2nn_buf_a, co2nn_buf_b, AK_CO2NN_L2_STEPS, CO2NN_L2CONV_INPUTS, CO2NN_L2CONV_OUTPUTS,
+                        co2nn_l2conv_weights, co2nn_l2conv_bias, co2nn_l2conv_shifts, 0);
+        CALL$(layer);
+
+        co2nn_set_layer(co2nn_buf_b, co2nn_buf_a, 1, CO2NN_L3FC_INPUTS, CO2NN_L3FC_OUTPUTS,
+                        co2nn_l3fc_weights, co2nn_l3fc_bias, co2nn_l3fc_shifts, 0);
+        CALL$(layer);
+
+        co2nn_set_layer(co2nn_buf_a, co2nn_buf_b, 1, CO2NN_L4FC_INPUTS, CO2NN_L4FC_OUTPUTS,
+                        co2nn_l4fc_weights, co2nn_l4fc_bias, co2nn_l4fc_shifts, 0);
+        CALL$(layer);
+
+        co2nn_set_layer(co2nn_buf_b, co2nn_buf_a, 1, CO2NN_OUTPUT_INPUTS, CO2NN_OUTPUT_OUTPUTS,
+                        co2nn_output_weights, co2nn_output_bias, co2nn_output_shifts, 0);
+        CALL$(layer);
+
+        co2nn_end_slice();
+
+        // Output is scaled offset from PH600 (see descalePhOffset on host): offset = output * 2 - 1
+        ph_milli = ph600_milli + (i32)co2nn_buf_a[0] * 2000L / AK_CO2NN_ONE - 1000;
+
+        co2nn_prediction_milli_ph = ph_milli < 0 ? 0 : (u16)ph_milli;
+        co2nn_prediction_on_close = on_close;
+        co2nn_prediction_cycles = co2nn_slices_cycles;
+        // Zero means there is no prediction yet
+        co2nn_prediction_id = co2nn_prediction_id == 255 ? 1 : co2nn_prediction_id + 1;
+
+        TRACE_CO2NN_PREDICTION(co2nn_prediction_milli_ph, on_close, co2nn_prediction_cycles);
+    }
+}
+
+X_EVERY_DECISECOND$(co2nn_ticker) {
+    co2nn_sample_deciseconds += 1;
+
+    const u8 valve_open = co2_switch.is_set();
+
+    if (co2nn_valve_open && !valve_open) {
+        // Valve is just closed, sample right now, so prediction uses the latest PH.
+        // It's never dropped: if the thread is busy with a 'what if' one, it's made right after it.
+        co2nn_add_sample();
+        co2nn_requested = AKAT_ONE;
+        co2nn_requested_on_close = AKAT_ONE;
+    } else if (co2nn_sample_deciseconds >= AK_CO2NN_SAMPLE_DECISECONDS) {
+        co2nn_add_sample();
+        if (valve_open) {
+            co2nn_requested = AKAT_ONE;
         }
     }
+
+    co2nn_valve_open = valve_open;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -618,33 +3055,90 @@ X_INIT$(usart0_init) {
 
 // ----------------------------------------------------------------
 // USART0(USB): Interrupt handler for 'byte is received' event..
+//
+// It's naked and written in assembler, so that it's cheap enough for baud rates way above 250k
+// (a byte comes every 640 cycles at 250k and every 160 cycles at 1M, USART0 holds 2 bytes + the one being shifted in):
+//   - buffer is aligned to 256, so hi8(buffer):index is the address of a slot and 'st Z+' wraps the index
+//   - only Z and r24 (the received byte) are pushed, indexes are in SRAM: registers pinned with USE_REG$
+//     are no good here, libgcc/libm (float math) is not built with -ffixed-* and may save, use and restore them
+//     around our interrupt, so an update of the index would be lost
+//   - fast path doesn't change flags (cpse, st Z+), SREG is saved only when the buffer is full
+//   - the byte always goes into the next empty slot (it's free even if the buffer is full),
+//     the index moves on unless it would catch up with usart0_rx_next_read_idx
+//
+// Cycles counted by hand from the instructions (not measured yet), including 5 cycles of interrupt response
+// and 3 of jmp in the vector table (ATmega2560):
+//   - a byte:                                    43
+//   - a byte, buffer is full:                    54 (53 if usart0_rx_overflow_count is saturated)
+//   - 'T' (time sync request):                   40 + __vector_usart0_rx_time_sync (51 + it if buffer is full)
+// 'make bench' (simavr) reports the worst case of a run as isr_max_cycles_per_call.USART0_RX, 'T' included
+// (bench.c counts from jmp in the vector table, so it's 5 cycles less than here).
 
 GLOBAL$() {
-    STATIC_VAR$(volatile u8 usart0_rx_bytes_buf[AK_USART0_RX_BUF_SIZE], initial = {});
     STATIC_VAR$(volatile u8 usart0_rx_overflow_count);
-    STATIC_VAR$(volatile u8 usart0_rx_next_empty_idx);
     STATIC_VAR$(volatile u8 usart0_rx_next_read_idx);
+    STATIC_VAR$(volatile u8 usart0_rx_next_empty_idx);
 }
 
-ISR(USART0_RX_vect) {
-    u8 b = UDR0; // we must read here, no matter what, to clear interrupt flag
+static volatile u8 usart0_rx_bytes_buf[AK_USART0_RX_BUF_SIZE] __attribute__((aligned(256)));
+
+ISR(USART0_RX_vect, ISR_NAKED) {
+    asm volatile(
+        "push r30\n"
+        "push r31\n"
+        "push r24\n"
+        "lds r24, %[udr]\n"                // we must read here, no matter what, to clear interrupt flag
+        "lds r30, %[empty_idx]\n"
+        "ldi r31, hi8(%[buf])\n"
+        "st Z+, r24\n"                     // r30 is the next index now
+        "lds r31, %[read_idx]\n"
+        "cpse r30, r31\n"
+        "rjmp 1f\n"
+
+        // Buffer is full, count it (saturated). Flags are changed only here
+        "in r31, __SREG__\n"
+        "push r31\n"
+        "lds r30, %[overflows]\n"
+        "inc r30\n"
+        "breq 3f\n"
+        "sts %[overflows], r30\n"
+        "3: pop r31\n"
+        "out __SREG__, r31\n"
+        "rjmp 2f\n"
+
+        "1: sts %[empty_idx], r30\n"
+
+        // 'T' is stamped for time sync, the rest of the job is a C function that returns with reti
+        "2: ldi r31, 'T'\n"
+        "cpse r24, r31\n"
+        "rjmp 4f\n"
+        "pop r24\n"
+        "pop r31\n"
+        "pop r30\n"
+        "jmp %x[time_sync]\n"
+
+        "4: pop r24\n"
+        "pop r31\n"
+        "pop r30\n"
+        "reti\n"
+        :
+        : [udr] "n" (_SFR_MEM_ADDR(UDR0)), [buf] "i" (usart0_rx_bytes_buf), [empty_idx] "i" (&usart0_rx_next_empty_idx),
+          [read_idx] "i" (&usart0_rx_next_read_idx), [overflows] "i" (&usart0_rx_overflow_count),
+          [time_sync] "i" (__vector_usart0_rx_time_sync));
+}
 
-    u8 new_next_empty_idx = (usart0_rx_next_empty_idx + AKAT_ONE) & (AK_USART0_RX_BUF_SIZE - 1);
-    if (new_next_empty_idx == usart0_rx_next_read_idx) {
-        usart0_rx_overflow_count += AKAT_ONE;
-        // Don't let it overflow!
-        if (!usart0_rx_overflow_count) {
-            usart0_rx_overflow_count -= AKAT_ONE;
-        }
-    } else {
-        usart0_rx_bytes_buf[usart0_rx_next_empty_idx] = b;
-        usart0_rx_next_empty_idx = new_next_empty_idx;
-    }
+FUNCTION$(u8 usart0_rx_has_bytes()) {
+    return usart0_rx_next_empty_idx != usart0_rx_next_read_idx;
 }
 
 // ----------------------------------------------------------------
 // USART0(USB): This thread continuously writes current status into USART0
 
+GLOBAL$() {
+    // Host asks for binary status with 'S' command, it's text after reset (see protocol.json)
+    STATIC_VAR$(u8 status_format);
+}
+
 // NOTE: Just replace state_type to u16 if we ran out of state space..
 THREAD$(usart0_writer, state_type = u8) {
     // ---- All variable in the thread must be static (green threads requirement)
@@ -653,10 +3147,15 @@ THREAD$(usart0_writer, state_type = u8) {
     STATIC_VAR$(u8 u8_to_format_and_send);
     STATIC_VAR$(u16 u16_to_format_and_send);
     STATIC_VAR$(u32 u32_to_format_and_send);
+    STATIC_VAR$(u8 binary_byte);
 
-    STATIC_VAR$(u24 __ph_adc_accum);
-    STATIC_VAR$(u16 __ph_adc_accum_samples);
-    STATIC_VAR$(u16 __ph_adc_bad_samples);
+    STATIC_VAR$(PhAdcBatch __ph_adc_batch, initial = {});
+
+    STATIC_VAR$(Event __event, initial = {});
+    STATIC_VAR$(u8 __events_seq);
+    STATIC_VAR$(u8 __events_left);
+
+    STATIC_VAR$(u8 __trace_end_idx);
 
     // ---- Subroutines can yield unlike functions
 
@@ -712,20 +3211,28 @@ THREAD$(usart0_writer, state_type = u8) {
         }
     }
 
-    // ---- Macro that writes the given status into UART
-    // We also write some humand readable description of the protocol
-    // also stuff to distinguish protocol versions and generate typescript parser code
+    // Sends binary_byte of binary status, bytes that could be taken for the end of line are escaped.
+    // CRC is of unescaped bytes.
+    SUB$(send_binary_byte) {
+        crc = akat_crc_add(crc, binary_byte);
+
+        if (binary_byte == '\r' || binary_byte == '\n' || binary_byte == AK_PROTOCOL_ESCAPE) {
+            WAIT_UNTIL$(UCSR0A & H(UDRE0), unlikely);
+            UDR0 = AK_PROTOCOL_ESCAPE;
+            binary_byte ^= 0x20;
+        }
+
+        WAIT_UNTIL$(UCSR0A & H(UDRE0), unlikely);
+        UDR0 = binary_byte;
+    }
+
+    // ---- Macros that write the given status into UART, calls are generated by maintain-protocol
 
     DEFINE_MACRO$(WRITE_STATUS, required_args = ["name", "id"], keep_rest_as_is = True) {
         byte_to_send = ' '; CALL$(send_byte);
         byte_to_send = '${id}'; CALL$(send_byte);
 
         % for arg in rest:
-            /*
-              COMMPROTO: ${id}${loop.index+1}: ${name.replace('"', "")}: ${arg}
-              TS_PROTO_TYPE: "${arg}": number,
-              TS_PROTO_ASSIGN: "${arg}": vals["${id}${loop.index+1}"],
-            */
             <% [argt, argn] = arg.split(" ", 1) %>
             ${argt}_to_format_and_send = ${argn}; CALL$(format_and_send_${argt});
             % if not loop.last:
@@ -734,107 +3241,168 @@ THREAD$(usart0_writer, state_type = u8) {
         % endfor
     }
 
+    // Little endian, at offsets known to the host
+    DEFINE_MACRO$(WRITE_STATUS_BINARY, required_args = ["name"], keep_rest_as_is = True) {
+        % for arg in rest:
+            <% [argt, argn] = arg.split(" ", 1) %>
+            ${argt}_to_format_and_send = ${argn};
+            % for i in range(int(argt[1:]) // 8):
+                binary_byte = (u8)(${argt}_to_format_and_send >> ${i * 8}); CALL$(send_binary_byte);
+            % endfor
+        % endfor
+    }
+
     // - - - - - - - - - - -
     // Main loop in thread (thread will yield on calls to YIELD$ or WAIT_UNTIL$)
     while(1) {
         // ---- - - - - -- - - - - - - -
-        // Write debug if there is some
-        if (debug_next_empty_idx != debug_next_read_idx) {
-            while (debug_next_empty_idx != debug_next_read_idx) {
-                byte_to_send = '>'; CALL$(send_byte);
+        // Write trace records if there are some, records added while we are writing go to the next line.
+        // See '%' in protocol.json.
+        if (trace_next_empty_idx != trace_next_read_idx) {
+            __trace_end_idx = trace_next_empty_idx;
+
+            byte_to_send = '%'; CALL$(send_byte);
+            crc = 0;
 
+            u32_to_format_and_send = timer1_periods;
+            binary_byte = (u8)u32_to_format_and_send; CALL$(send_binary_byte);
+            binary_byte = (u8)(u32_to_format_and_send >> 8); CALL$(send_binary_byte);
+            binary_byte = (u8)(u32_to_format_and_send >> 16); CALL$(send_binary_byte);
+            binary_byte = (u8)(u32_to_format_and_send >> 24); CALL$(send_binary_byte);
+
+            while (trace_next_read_idx != __trace_end_idx) {
                 // Read byte first, then increment idx!
-                u8_to_format_and_send = debug_bytes_buf[debug_next_read_idx];
-                debug_next_read_idx = (debug_next_read_idx + 1) & (AK_DEBUG_BUF_SIZE - 1);
+                binary_byte = trace_buf[trace_next_read_idx];
+                trace_next_read_idx = (trace_next_read_idx + 1) & (AK_TRACE_BUF_SIZE - 1);
 
-                CALL$(format_and_send_u8);
+                CALL$(send_binary_byte);
             }
 
+            binary_byte = crc; CALL$(send_binary_byte);
+
             byte_to_send = '\r'; CALL$(send_byte);
             byte_to_send = '\n'; CALL$(send_byte);
         }
 
 
+        // ---- - - - - -- - - - - - - -
+        // Write time sync reply if requested.
+        // First byte is written right after the stamp is taken, so it's not written by send_byte.
+        // See '=' in protocol.json.
+        if (time_sync_seq) {
+            WAIT_UNTIL$(UCSR0A & H(UDRE0), unlikely);
+            take_time_sync_tx_stamp();
+            UDR0 = '=';
+            crc = akat_crc_add(0, '=');
+
+            u8_to_format_and_send = time_sync_seq; CALL$(format_and_send_u8);
+            byte_to_send = ','; CALL$(send_byte);
+            u32_to_format_and_send = time_sync_reply_rx_periods; CALL$(format_and_send_u32);
+            byte_to_send = ','; CALL$(send_byte);
+            u16_to_format_and_send = time_sync_reply_rx_ticks; CALL$(format_and_send_u16);
+            byte_to_send = ','; CALL$(send_byte);
+            u32_to_format_and_send = timer1_timestamp_periods; CALL$(format_and_send_u32);
+            byte_to_send = ','; CALL$(send_byte);
+            u16_to_format_and_send = timer1_timestamp_ticks; CALL$(format_and_send_u16);
+            byte_to_send = ','; CALL$(send_byte);
+            u32_to_format_and_send = time_sync_tx_clock; CALL$(format_and_send_u32);
+
+            byte_to_send = ' '; CALL$(send_byte);
+            u8_to_format_and_send = crc; CALL$(format_and_send_u8);
+
+            byte_to_send = '\r'; CALL$(send_byte);
+            byte_to_send = '\n'; CALL$(send_byte);
+
+            time_sync_seq = 0;
+        }
+
         // ----  - - - - -- - - - - -
 
-        crc = 0;
+        // Take the oldest closed batch of PH ADC samples (if any).
+        // If there is none, then the previous one is sent again and host recognizes it by its tick.
+        if (ph_adc_batch_fifo_next_empty_idx != ph_adc_batch_fifo_next_read_idx) {
+            // Read batch first, then increment idx!
+            __ph_adc_batch = ph_adc_batch_fifo[ph_adc_batch_fifo_next_read_idx];
+            ph_adc_batch_fifo_next_read_idx = (ph_adc_batch_fifo_next_read_idx + 1) & (AK_PH_BATCH_FIFO_SIZE - 1);
+        }
 
-        // WRITE_STATUS(name for documentation, 1-character id for protocol, type1 val1, type2 val2, ...)
-
-        WRITE_STATUS$(Misc,
-                      A,
-                      u32 uptime_deciseconds,
-                      u8 debug_overflow_count,
-                      u8 usart0_rx_overflow_count,
-                      u32 main_loop_iterations_in_last_decisecond,
-                      u32 ((u32)last_drift_of_clock_deciseconds_since_midnight),
-                      u32 clock_corrections_since_protection_stat_reset,
-                      u32 clock_deciseconds_since_midnight);
-
-        WRITE_STATUS$("Aquarium temperature sensor",
-                      B,
-                      u8 ds18b20_aqua.get_crc_errors(),
-                      u8 ds18b20_aqua.get_disconnects(),
-                      u16 ds18b20_aqua.get_temperatureX16(),
-                      u8 ds18b20_aqua.get_update_id(),
-                      u8 ds18b20_aqua.get_updated_deciseconds_ago());
-
-        WRITE_STATUS$("Case temperature sensor",
-                      C,
-                      u8 ds18b20_case.get_crc_errors(),
-                      u8 ds18b20_case.get_disconnects(),
-                      u16 ds18b20_case.get_temperatureX16(),
-                      u8 ds18b20_case.get_update_id(),
-                      u8 ds18b20_case.get_updated_deciseconds_ago());
-
-        WRITE_STATUS$("CO2",
-                      D,
-                      u8 co2_switch.is_set() ? 1 : 0,
-                      u8 co2_calculated_day ? 1 : 0,
-                      u8 co2_force_off.is_set() ? 1 : 0,
-                      u8 required_co2_switch_state.is_set() ? 1 : 0,
-                      u32 co2_deciseconds_until_can_turn_on);
-
-        WRITE_STATUS$("Light",
-                      E,
-                      u8 day_light_switch.is_set() ? 1 : 0,
-                      u8 night_light_switch.is_set() ? 1 : 0,
-                      u8 day_light_forced.is_set() ? 1 : 0,
-                      u8 night_light_forced.is_set() ? 1 : 0,
-                      u8 light_forces_since_protection_stat_reset,
-                      u8 alternative_day_enabled);
-
-        // Special handling for ph meter ADC result.
-        // Remember values before writing and then set current accum values to zero
-        // This is because of this thread might YIELD and we don't want our stuff to be
-        // messes up in the middle of the process.
-        __ph_adc_accum = ph_adc_accum;
-        __ph_adc_accum_samples = ph_adc_accum_samples;
-        __ph_adc_bad_samples = ph_adc_bad_samples;
-
-        // Set to zero to start a new oversampling batch
-        ph_adc_accum = 0;
-        ph_adc_accum_samples = 0;
-        ph_adc_bad_samples = 0;
-
-        // Write Voltage status... this might YIELD
-        WRITE_STATUS$("PH Voltage",
-                      F,
-                      u32 __ph_adc_accum,
-                      u16 __ph_adc_accum_samples,
-                      u16 __ph_adc_bad_samples);
-
-        // Protocol version
-        byte_to_send = ' '; CALL$(send_byte);
-        u8_to_format_and_send = AK_PROTOCOL_VERSION; CALL$(format_and_send_u8);
+        crc = 0;
 
-        // Done writing status, send: CRC\r\n
-        byte_to_send = ' '; CALL$(send_byte);
-        u8_to_format_and_send = crc; CALL$(format_and_send_u8);
+        // Writing status might YIELD
+        // Generated by maintain-protocol from protocol.json. It's DSL, so Makefile inlines it
+        // before akatpp (maintain-protocol --inline), the C preprocessor never sees this line.
+        #include "protocol_status.inc"
 
         // Newline
         byte_to_send = '\r'; CALL$(send_byte);
         byte_to_send = '\n'; CALL$(send_byte);
+
+        // ---- - - - - -- - - - - - - -
+        // Write events if host asked for them (see 'Event log').
+        // Line has no events if there is nothing new since the requested sequence number.
+        // See '!' in protocol.json.
+        if (events_requested) {
+            events_requested = 0;
+            crc = 0;
+
+            byte_to_send = '!'; CALL$(send_byte);
+            u32_to_format_and_send = timer1_periods; CALL$(format_and_send_u32);
+            byte_to_send = ','; CALL$(send_byte);
+
+            __events_seq = get_available_event_seq(events_requested_seq);
+            u8_to_format_and_send = __events_seq; CALL$(format_and_send_u8);
+
+            __events_left = AK_EVENTS_PER_LINE;
+            while (__events_left && __events_seq != events_next_seq) {
+                // Copy first, the ring might be updated while we are writing
+                __event = events[__events_seq & (AK_EVENTS_SIZE - 1)];
+                __events_seq += 1;
+                __events_left -= 1;
+
+                byte_to_send = ','; CALL$(send_byte);
+                u32_to_format_and_send = __event.tick; CALL$(format_and_send_u32);
+                byte_to_send = ','; CALL$(send_byte);
+                u8_to_format_and_send = __event.code; CALL$(format_and_send_u8);
+                byte_to_send = ','; CALL$(send_byte);
+                u16_to_format_and_send = __event.arg; CALL$(format_and_send_u16);
+            }
+
+            byte_to_send = ' '; CALL$(send_byte);
+            u8_to_format_and_send = crc; CALL$(format_and_send_u8);
+
+            byte_to_send = '\r'; CALL$(send_byte);
+            byte_to_send = '\n'; CALL$(send_byte);
+        }
+
+        // ---- - - - - -- - - - - - - -
+        // Write a chunk of capture if there is one ready and there are no PH batches waiting.
+        // Batches are more important, we don't want them to overflow because of captures.
+        // See '~' in protocol.json.
+        if (capture_state == CaptureReady && ph_adc_batch_fifo_next_empty_idx == ph_adc_batch_fifo_next_read_idx) {
+            crc = 0;
+
+            byte_to_send = '~'; CALL$(send_byte);
+            u8_to_format_and_send = capture_id; CALL$(format_and_send_u8);
+            byte_to_send = ','; CALL$(send_byte);
+            u16_to_format_and_send = capture_sent_samples; CALL$(format_and_send_u16);
+
+            do {
+                byte_to_send = ','; CALL$(send_byte);
+                u16_to_format_and_send = capture_buf[(capture_next_idx + capture_sent_samples) & (AK_CAPTURE_SAMPLES - 1)];
+                CALL$(format_and_send_u16);
+                capture_sent_samples += 1;
+            } while (capture_sent_samples % AK_CAPTURE_CHUNK_SAMPLES);
+
+            byte_to_send = ' '; CALL$(send_byte);
+            u8_to_format_and_send = crc; CALL$(format_and_send_u8);
+
+            byte_to_send = '\r'; CALL$(send_byte);
+            byte_to_send = '\n'; CALL$(send_byte);
+
+            if (capture_sent_samples == AK_CAPTURE_SAMPLES) {
+                capture_state = CaptureDisarmed;
+            }
+        }
     }
 }
 
@@ -858,7 +3426,7 @@ THREAD$(usart0_reader) {
         // Gets byte from usart0_rx_bytes_buf buffer.
         SUB$(dequeue_byte) {
             // Wait until there is something to read
-            WAIT_UNTIL$(usart0_rx_next_empty_idx != usart0_rx_next_read_idx, unlikely);
+            WAIT_UNTIL$(usart0_rx_has_bytes(), unlikely);
 
             // Read byte first, then increment idx!
             dequeued_byte = usart0_rx_bytes_buf[usart0_rx_next_read_idx];
@@ -927,36 +3495,67 @@ THREAD$(usart0_reader) {
         CALL$(read_command);
 
         switch(command_code) {
-        case 'F':
-            co2_force_off.set(AKAT_ONE);
+        case AK_COMMAND_CO2_FORCE_OFF:
+            set_timed_flag(Co2ForceOffTimer, AKAT_ONE, AK_FORCE_TIMEOUT_DECISECONDS);
+            log_event(EventCo2ForcedOff, 0);
             break;
 
-        case 'G':
+        case AK_COMMAND_CO2_REQUIRED_STATE:
             update_co2_switch_state(command_arg);
             break;
 
-        case 'L':
+        case AK_COMMAND_LIGHT_FORCE:
             force_light(command_arg);
             break;
 
-        case 'D':
-            set_alt_day(command_arg);
+        case AK_COMMAND_SCHEDULE_PROFILE:
+            set_schedule_profile(command_arg);
             break;
 
-        case 'A':
+        case AK_COMMAND_CLOCK0:
             // Least significant clock byte
             received_clock0 = command_arg;
             break;
 
-        case 'B':
+        case AK_COMMAND_CLOCK1:
             received_clock1 = command_arg;
             break;
 
-        case 'C':
+        case AK_COMMAND_CLOCK2:
             // Most significant clock byte. This one is supposed to be received LAST.
             // ('A' and 'B') must be already here.
             received_clock2 = command_arg;
             break;
+
+        case AK_COMMAND_UPLOAD_BYTE:
+            upload_byte(command_arg);
+            break;
+
+        case AK_COMMAND_UPLOAD_COMMIT:
+            commit_upload(command_arg);
+            break;
+
+        case AK_COMMAND_ARM_CAPTURE:
+            arm_capture(command_arg);
+            break;
+
+        case AK_COMMAND_TIME_SYNC:
+            request_time_sync(command_arg);
+            break;
+
+        case AK_COMMAND_PHASE_ADJUSTMENT:
+            // Signed, see AK_TIME_SYNC_PHASE_TICKS_PER_UNIT
+            clock_phase_adjustment = (i8)command_arg;
+            break;
+
+        case AK_COMMAND_EVENTS:
+            events_requested_seq = command_arg;
+            events_requested = AKAT_ONE;
+            break;
+
+        case AK_COMMAND_STATUS_FORMAT:
+            status_format = command_arg;
+            break;
         }
     }
 }
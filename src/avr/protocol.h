@@ -0,0 +1,73 @@
+// This file is auto-generated by src/avr/maintain-protocol from src/avr/protocol.json! DON'T EDIT!
+
+#define AK_PROTOCOL_VERSION  0xe5bf
+#define AK_PROTOCOL_ESCAPE  0x7d
+
+// Version and fields of binary status, without CRC
+#define AK_STATUS_FRAME_SIZE  116
+
+// Commands: <Xarg Xarg>
+#define AK_COMMAND_CO2_FORCE_OFF  'F'
+#define AK_COMMAND_CO2_REQUIRED_STATE  'G'
+#define AK_COMMAND_LIGHT_FORCE  'L'
+#define AK_COMMAND_SCHEDULE_PROFILE  'D'
+#define AK_COMMAND_CLOCK0  'A'
+#define AK_COMMAND_CLOCK1  'B'
+#define AK_COMMAND_CLOCK2  'C'
+#define AK_COMMAND_UPLOAD_BYTE  'U'
+#define AK_COMMAND_UPLOAD_COMMIT  'V'
+#define AK_COMMAND_ARM_CAPTURE  'R'
+#define AK_COMMAND_TIME_SYNC  'T'
+#define AK_COMMAND_PHASE_ADJUSTMENT  'P'
+#define AK_COMMAND_EVENTS  'E'
+#define AK_COMMAND_STATUS_FORMAT  'S'
+#define AK_STATUS_FORMAT_TEXT  0
+#define AK_STATUS_FORMAT_BINARY  1
+
+// Tracepoints: TRACE_<NAME>(args) writes a record into the trace ring (see 'Tracing' in main.c)
+#define AK_TRACEPOINTS  5
+
+// ClockCorrected: Clock was set to the one received from the host
+#define TRACE_CLOCK_CORRECTED(drift_deciseconds, trim_ppm_x8) do { \
+        if (trace_begin(1, 6, 0)) { \
+            trace_put_u32((u32)(drift_deciseconds)); \
+            trace_put_u16((u16)(trim_ppm_x8)); \
+            trace_end(); \
+        } \
+    } while (0)
+
+// UploadRejected: Committed upload has wrong size, CRC or content
+#define TRACE_UPLOAD_REJECTED(target, size) do { \
+        if (trace_begin(2, 2, 10)) { \
+            trace_put_u8((u8)(target)); \
+            trace_put_u8((u8)(size)); \
+            trace_end(); \
+        } \
+    } while (0)
+
+// PhBatchDropped: Batch of PH ADC samples was closed while the FIFO was full
+#define TRACE_PH_BATCH_DROPPED(tick) do { \
+        if (trace_begin(3, 4, 50)) { \
+            trace_put_u32((u32)(tick)); \
+            trace_end(); \
+        } \
+    } while (0)
+
+// PhSafetyLockout: CO2 lockout because of low PH was switched
+#define TRACE_PH_SAFETY_LOCKOUT(lockout, milli_ph) do { \
+        if (trace_begin(4, 3, 0)) { \
+            trace_put_u8((u8)(lockout)); \
+            trace_put_u16((u16)(milli_ph)); \
+            trace_end(); \
+        } \
+    } while (0)
+
+// Co2nnPrediction: CO2 NN made a prediction
+#define TRACE_CO2NN_PREDICTION(milli_ph, on_close, cycles) do { \
+        if (trace_begin(5, 7, 600)) { \
+            trace_put_u16((u16)(milli_ph)); \
+            trace_put_u8((u8)(on_close)); \
+            trace_put_u32((u32)(cycles)); \
+            trace_end(); \
+        } \
+    } while (0)
@@ -1,6 +1,7 @@
 WRITE_CFLAGS$(firmware);
 
 // NOTE: Sometimes it's nice to try to see which one is best to have some not low, must try some combinations
+// (make autotune measures combinations under simavr and writes the best one here)
 // USE_REG$(global variable name, low);
 
 USE_REG$(usart0_writer__akat_coroutine_state);
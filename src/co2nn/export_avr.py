@@ -0,0 +1,224 @@
+import json
+import sys
+
+import h5py
+import numpy as np
+
+from print_utils import STRESS_COLOR, ff, print_error, print_info
+
+# Converts trained min-PH prediction model (see trainco2.py) into int8 weights for AVR firmware.
+#
+# Every layer of the model is either Conv1D with kernel_size == strides (i.e. it's a dense layer
+# applied to non-overlapping chunks of kernel_size time steps) or Dense, so firmware implements
+# all of them with the same fixed point kernel (see 'CO2 NN' in src/avr/main.c):
+#   - activations are i16 in Q12 (value * 4096), activations of this model are within (-2, 1)
+#   - weights are i8 scaled by 2 ^ shift, every output has its own shift (the largest one that fits)
+#   - the first layer has i16 weights, because features change by small amounts and int8
+#     weights of the first layer alone make error of prediction ~0.1 PH
+#   - biases are i32, already scaled to accumulator (Q12 * 2 ^ shift)
+#   - accumulator is shifted back into Q12 (with rounding) and passed through SELU
+# SELU for negative values uses a table of AVR_SELU_TABLE_SIZE entries with linear interpolation.
+
+MODEL_FILENAME = "data/co2-model.h5"
+HEADER_FILENAME = "src/avr/co2nn_model.h"
+
+# Must be in harmony with PH_PREDICTION_WINDOW_LENGTH / PH_PREDICTION_FEATURES in trainco2.py
+WINDOW_LENGTH = 60
+FEATURES = 5
+
+SELU_ALPHA = 1.6732632423543772
+SELU_SCALE = 1.0507009873554805
+
+AVR_ACTIVATION_BITS = 12
+
+# Negative part of SELU is tabulated for [-8, 0] with step 1/8 (512 units in Q12)
+AVR_SELU_TABLE_SIZE = 65
+AVR_SELU_TABLE_STEP_BITS = 9
+
+# SELU_SCALE in Q12
+AVR_SELU_SCALE_Q12 = 4304
+
+# Number of random inputs used to estimate error of quantization
+CHECK_EXAMPLES = 2000
+
+
+class Layer:
+    def __init__(self, name: str, kernel_size: int, kernel: np.ndarray, bias: np.ndarray, wide: bool):
+        self.name = name
+        self.kernel_size = kernel_size
+        self.wide = wide
+
+        # [out][in] where in is (time step, channel) of a chunk, that's how they are in AVR memory
+        self.weights = kernel.reshape(-1, kernel.shape[-1]).T
+        self.bias = bias
+
+        max_qweight = 32767 if wide else 127
+        self.shifts = []
+        for w in self.weights:
+            max_weight = np.max(np.abs(w))
+            shift = min(int(np.floor(np.log2(max_qweight / max_weight))), 16) if max_weight > 0 else 0
+            if shift < 1:
+                raise ValueError("Layer " + name + " has too large weights: " + ff(max_weight))
+            self.shifts.append(shift)
+
+        self.qweights = np.array([np.round(w * (1 << s)) for w, s in zip(self.weights, self.shifts)]).astype(np.int64)
+        self.qbias = np.array([round(b * (1 << (s + AVR_ACTIVATION_BITS))) for b, s in zip(self.bias, self.shifts)]).astype(np.int64)
+
+    @property
+    def inputs(self) -> int:
+        return self.weights.shape[1]
+
+    @property
+    def outputs(self) -> int:
+        return self.weights.shape[0]
+
+
+def load_layers(filename: str):
+    layers = []
+
+    with h5py.File(filename, "r") as f:
+        config = json.loads(f.attrs["model_config"])
+
+        for l in config["config"]["layers"]:
+            cls = l["class_name"]
+            c = l["config"]
+
+            if cls in ("InputLayer", "Flatten") or cls.endswith("Dropout"):
+                continue
+
+            if cls == "Conv1D":
+                if c["kernel_size"] != c["strides"] or c["padding"] != "valid":
+                    raise ValueError("Conv1D layer " + l["name"] + " must have kernel_size == strides and valid padding")
+                kernel_size = c["kernel_size"][0]
+            elif cls == "Dense":
+                kernel_size = 1
+            else:
+                raise ValueError("Unsupported layer " + l["name"] + " (" + cls + ")")
+
+            if c["activation"] != "selu":
+                raise ValueError("Layer " + l["name"] + " must use selu activation")
+
+            w = f["model_weights"][l["name"]][l["name"]]
+            layers.append(Layer(l["name"], kernel_size, w["kernel:0"][()], w["bias:0"][()], wide=not layers))
+
+    return layers
+
+
+def selu(x: np.ndarray) -> np.ndarray:
+    return SELU_SCALE * np.where(x > 0, x, SELU_ALPHA * (np.exp(np.minimum(x, 0)) - 1))
+
+
+def make_selu_table():
+    one = 1 << AVR_ACTIVATION_BITS
+    step = (1 << AVR_SELU_TABLE_STEP_BITS) / one
+    return [int(round(one * SELU_SCALE * SELU_ALPHA * (np.exp(-i * step) - 1))) for i in range(AVR_SELU_TABLE_SIZE)]
+
+
+def predict_float(layers, xs: np.ndarray) -> float:
+    a = xs.reshape(-1)
+    for l in layers:
+        a = selu(a.reshape(-1, l.inputs) @ l.weights.T + l.bias).reshape(-1)
+    return float(a[0])
+
+
+# Exactly what firmware does (Python's >> is arithmetic, like avr-gcc's)
+def predict_fixed(layers, selu_table, xs: np.ndarray) -> float:
+    def fixed_selu(x: int) -> int:
+        if x > 0:
+            return min((x * AVR_SELU_SCALE_Q12) >> AVR_ACTIVATION_BITS, 32767)
+
+        d = -x
+        i = d >> AVR_SELU_TABLE_STEP_BITS
+        if i >= AVR_SELU_TABLE_SIZE - 1:
+            return selu_table[-1]
+
+        frac = d & ((1 << AVR_SELU_TABLE_STEP_BITS) - 1)
+        return selu_table[i] + (((selu_table[i + 1] - selu_table[i]) * frac) >> AVR_SELU_TABLE_STEP_BITS)
+
+    a = [int(round(v * (1 << AVR_ACTIVATION_BITS))) for v in xs.reshape(-1)]
+    for l in layers:
+        out = []
+        for s in range(len(a) // l.inputs):
+            chunk = a[s * l.inputs:(s + 1) * l.inputs]
+            for f in range(l.outputs):
+                acc = int(l.qbias[f]) + sum(int(w) * v for w, v in zip(l.qweights[f], chunk))
+                out.append(fixed_selu((acc + (1 << (l.shifts[f] - 1))) >> l.shifts[f]))
+        a = out
+    return a[0] / (1 << AVR_ACTIVATION_BITS)
+
+
+# Features are the same as in createCo2ClosingStateFeaturesAndLabels (PhPredictionWorkerThread.ts)
+def random_features(rng: np.random.Generator) -> np.ndarray:
+    xs = np.zeros((WINDOW_LENGTH, FEATURES))
+    xs[:, 0] = rng.uniform(0.2, 0.8)
+    xs[:, 1] = np.clip(0.5 + np.cumsum(rng.normal(0, 0.005, WINDOW_LENGTH)), 0, 1)
+    xs[:, 2] = rng.integers(0, 2)
+    xs[:, 3] = np.arange(WINDOW_LENGTH) >= rng.integers(0, WINDOW_LENGTH)
+    xs[-1, 3] = 0
+    xs[:, 4] = rng.integers(0, 2)
+    return xs
+
+
+def format_array(ctype: str, name: str, values, per_line: int) -> str:
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(str(int(v)) for v in values[i:i + per_line]) + ",")
+    return "static const " + ctype + " " + name + "[" + str(len(values)) + "] PROGMEM = {\n" + "\n".join(lines) + "\n};\n"
+
+
+# Error is of scaled output, see scalePhOffset (PhPredictionWorkerThread.ts)
+def write_header(filename: str, layers, selu_table, error: float):
+    out = []
+    out.append("// This file is auto-generated by src/co2nn/export_avr.py from " + MODEL_FILENAME + "! DON'T EDIT!\n")
+    out.append("// Max error of quantized prediction on random inputs: " + "%.4f" % (error * 2) + " PH\n\n")
+    out.append("#define CO2NN_WINDOW_LENGTH  " + str(WINDOW_LENGTH) + "\n")
+    out.append("#define CO2NN_FEATURES  " + str(FEATURES) + "\n")
+    out.append("#define CO2NN_ACTIVATION_BITS  " + str(AVR_ACTIVATION_BITS) + "\n")
+    out.append("#define CO2NN_SELU_SCALE_Q12  " + str(AVR_SELU_SCALE_Q12) + "\n")
+    out.append("#define CO2NN_SELU_TABLE_SIZE  " + str(AVR_SELU_TABLE_SIZE) + "\n")
+    out.append("#define CO2NN_SELU_TABLE_STEP_BITS  " + str(AVR_SELU_TABLE_STEP_BITS) + "\n\n")
+    out.append(format_array("i16", "co2nn_selu_table", selu_table, 13))
+
+    for l in layers:
+        p = l.name.lower()
+        P = l.name.upper()
+        out.append("\n// " + l.name + ": " + str(l.kernel_size) + " step(s) of " + str(l.inputs // l.kernel_size)
+                   + " channel(s) -> " + str(l.outputs) + "\n")
+        out.append("#define CO2NN_" + P + "_INPUTS  " + str(l.inputs) + "\n")
+        out.append("#define CO2NN_" + P + "_OUTPUTS  " + str(l.outputs) + "\n")
+        out.append(format_array("i16" if l.wide else "i8", "co2nn_" + p + "_weights", l.qweights.reshape(-1), 8 if l.wide else 16))
+        out.append(format_array("i32", "co2nn_" + p + "_bias", l.qbias, 8))
+        out.append(format_array("u8", "co2nn_" + p + "_shifts", l.shifts, 16))
+
+    with open(filename, "w") as f:
+        f.write("".join(out))
+
+
+if __name__ == '__main__':
+    layers = load_layers(MODEL_FILENAME)
+    names = [l.name for l in layers]
+
+    # Firmware calls layers by these names
+    expected = ["L0aConv", "L0bConv", "L0cConv", "L1Conv", "L2Conv", "L3FC", "L4FC", "Output"]
+    if names != expected:
+        print_error("Unexpected layers: ", ", ".join(names), " (expected ", ", ".join(expected), ")")
+        sys.exit(1)
+
+    selu_table = make_selu_table()
+
+    rng = np.random.default_rng(1)
+    errors = []
+    for _ in range(CHECK_EXAMPLES):
+        xs = random_features(rng)
+        errors.append(abs(predict_float(layers, xs) - predict_fixed(layers, selu_table, xs)))
+    error = max(errors)
+
+    for l in layers:
+        print_info("Layer ", STRESS_COLOR, l.name, " ", l.inputs, " -> ", l.outputs, " shifts ", min(l.shifts), "..", max(l.shifts))
+
+    # Scaled output is (offset + 1) / 2, so PH error is twice as large
+    print_info("PH error of quantized model: max ", STRESS_COLOR, "%.4f" % (error * 2),
+               ", mean ", STRESS_COLOR, "%.4f" % (float(np.mean(errors)) * 2))
+
+    write_header(HEADER_FILENAME, layers, selu_table, error)
+    print_info("Written ", STRESS_COLOR, HEADER_FILENAME)
@@ -0,0 +1,181 @@
+import { PerformanceObserver, PerformanceEntry, constants } from "perf_hooks";
+import { SerialportReadlineParser } from "server/service_impl/ReadlineParser";
+import { AvrLineParser, addAvrCrc } from "server/avr/AvrLineParser";
+import { AvrData, AVR_PROTOCOL_ESCAPE, AVR_STATUS_FRAME_SIZE, avrProtocolVersion, decodeAvrStatusText, decodeAvrStatusFrame } from "server/avr/protocol";
+
+// Compares parsing of status lines by the readline parser + split + parseInt (how AvrServiceImpl used to do it)
+// with AvrLineParser, for text and binary status. Bytes come in chunks like from the serial port.
+//
+// Usage: npm run benchavrparser -- [<status lines>] [<chunk size>]
+
+const DEFAULT_LINES = 200000;
+const DEFAULT_CHUNK_SIZE = 64;
+const GC_ENTRIES_WAIT_MILLIS = 100;
+
+// Sections of a realistic status line, only uptime changes
+const SECTIONS = [
+    ",,,fc3a1,fffffff6,1c,ffe8,2f1c5,,5,,3", "B,,18f,c3,1", "C,,1d0,c4,1", "D1,1,,1,,2,7,1,2f1b7",
+    "E1,,,,,,6a,ff,", "F3a7c1,4d2e61,f0,,", "G6c0a3,190,1,5e,", "H6c1f0,3c,6c211,258", "I2,c1,1,1,19c8", "J7,19c8,1,3e8,1,5e"
+];
+
+function calcCrc(bytes: ArrayLike<number>): number {
+    let crc = 0;
+    for (let i = 0; i < bytes.length; i++) {
+        crc = addAvrCrc(crc, bytes[i]);
+    }
+    return crc;
+}
+
+function createTextStatus(uptimeDeciseconds: number): Buffer {
+    const subject = " A" + uptimeDeciseconds.toString(16) + SECTIONS.join(" ") + " " + avrProtocolVersion.toString(16) + " ";
+    const crc = calcCrc(Buffer.from(subject, "latin1"));
+    return Buffer.from(subject + (crc ? crc.toString(16) : "") + "\r\n", "latin1");
+}
+
+function createBinaryStatus(text: Buffer): Buffer {
+    const frames: Buffer[] = [];
+    new AvrLineParser(f => frames.push(Buffer.from(f.slice(0, AVR_STATUS_FRAME_SIZE))), () => undefined).write(text);
+    const frame = frames[0];
+    if (!frame) {
+        throw new Error("Status line is broken");
+    }
+
+    const bytes = [0x23];
+    [...frame, calcCrc(frame)].forEach(b => {
+        if (b === 0x0D || b === 0x0A || b === AVR_PROTOCOL_ESCAPE) {
+            bytes.push(AVR_PROTOCOL_ESCAPE, b ^ 0x20);
+        } else {
+            bytes.push(b);
+        }
+    });
+    return Buffer.from([...bytes, 0x0D, 0x0A]);
+}
+
+function asChunks(lines: Buffer[], chunkSize: number): Buffer[] {
+    const data = Buffer.concat(lines);
+    const chunks: Buffer[] = [];
+    for (let i = 0; i < data.length; i += chunkSize) {
+        chunks.push(data.slice(i, i + chunkSize));
+    }
+    return chunks;
+}
+
+// ========================================================================================
+
+// The way AvrServiceImpl parsed text status before AvrLineParser
+function parseWithSplit(data: string): AvrData | undefined {
+    data = data.replace("\r", "");
+    const fields = data.split(" ");
+    if (fields.length < 4 || fields[0] != '') {
+        return undefined;
+    }
+
+    const crcField = fields[fields.length - 1];
+    const crc = parseInt("0x" + (crcField || "0"));
+    const subject = data.substr(0, data.length - crcField.length);
+    let calculatedCrc = 0;
+    for (let i = 0; i < subject.length; i++) {
+        calculatedCrc = addAvrCrc(calculatedCrc, subject.charCodeAt(i));
+    }
+
+    if (calculatedCrc !== crc || parseInt("0x" + fields[fields.length - 2]) !== avrProtocolVersion) {
+        return undefined;
+    }
+
+    return decodeAvrStatusText(fields.slice(1, fields.length - 2));
+}
+
+function runReadline(chunks: Buffer[], onData: (avrData: AvrData) => void): Promise<void> {
+    return new Promise(resolve => {
+        const parser = new SerialportReadlineParser({ encoding: "latin1" }) as NodeJS.ReadWriteStream;
+        parser.on("data", (line: string) => {
+            const avrData = parseWithSplit(line);
+            if (avrData) {
+                onData(avrData);
+            }
+        });
+        parser.on("end", () => resolve());
+        chunks.forEach(chunk => parser.write(chunk));
+        parser.end();
+    });
+}
+
+async function runLineParser(chunks: Buffer[], onData: (avrData: AvrData) => void): Promise<void> {
+    const parser = new AvrLineParser(frame => onData(decodeAvrStatusFrame(frame)), () => undefined);
+    chunks.forEach(chunk => parser.write(chunk));
+}
+
+// ========================================================================================
+
+interface GcStats {
+    count: number;
+    minorCount: number;
+    millis: number;
+}
+
+function gcKind(entry: PerformanceEntry): number | undefined {
+    const detail = (entry as { detail?: { kind?: number } }).detail;
+    return detail ? detail.kind : entry.kind;
+}
+
+async function measure(name: string, lines: number, run: (onData: (avrData: AvrData) => void) => Promise<void>): Promise<void> {
+    const gc: GcStats = { count: 0, minorCount: 0, millis: 0 };
+    const observer = new PerformanceObserver(list => list.getEntries().forEach(entry => {
+        gc.count += 1;
+        gc.minorCount += gcKind(entry) === constants.NODE_PERFORMANCE_GC_MINOR ? 1 : 0;
+        gc.millis += entry.duration;
+    }));
+
+    let parsed = 0;
+    let checksum = 0;
+
+    observer.observe({ entryTypes: ["gc"] });
+    const started = process.hrtime();
+
+    await run(avrData => {
+        parsed += 1;
+        checksum += avrData.uptimeSeconds;
+    });
+
+    const [seconds, nanos] = process.hrtime(started);
+    const millis = seconds * 1000 + nanos / 1e6;
+
+    // GC entries are delivered asynchronously
+    await new Promise(resolve => setTimeout(resolve, GC_ENTRIES_WAIT_MILLIS));
+    observer.disconnect();
+
+    if (parsed !== lines) {
+        throw new Error(`${name}: parsed ${parsed} of ${lines} status lines`);
+    }
+
+    console.log(`${name.padEnd(24)} ${(lines / millis * 1000).toFixed(0).padStart(9)} frames/s `
+        + `${millis.toFixed(0).padStart(6)}ms, GC: ${gc.count} (${gc.minorCount} minor) ${gc.millis.toFixed(1)}ms, checksum ${checksum.toFixed(1)}`);
+}
+
+async function bench() {
+    const lines = Number(process.argv[2] || DEFAULT_LINES);
+    const chunkSize = Number(process.argv[3] || DEFAULT_CHUNK_SIZE);
+
+    const texts = Array.from({ length: lines }, (_, i) => createTextStatus(10000 + i));
+    const binaries = texts.map(createBinaryStatus);
+    const textChunks = asChunks(texts, chunkSize);
+    const binaryChunks = asChunks(binaries, chunkSize);
+
+    console.log(`${lines} status lines, ${chunkSize} bytes per chunk, `
+        + `${(texts[0].length)} bytes per text line, ${binaries[0].length} bytes per binary line`);
+
+    // Warm up, then measure
+    for (const round of ["warm-up", "measured"]) {
+        console.log(`\n${round}:`);
+        await measure("readline + split (text)", lines, onData => runReadline(textChunks, onData));
+        await measure("AvrLineParser (text)", lines, onData => runLineParser(textChunks, onData));
+        await measure("AvrLineParser (binary)", lines, onData => runLineParser(binaryChunks, onData));
+    }
+}
+
+// ========================================================================================
+
+bench().catch(error => {
+    console.error(error);
+    process.exit(-1);
+});
@@ -0,0 +1,183 @@
+import "reflect-metadata";
+import logger from "server/logger";
+import { exit } from "process";
+import { readFileSync } from "fs";
+import { Subject, VirtualTimeScheduler, SchedulerLike } from "rxjs";
+import { createNewContainer } from "server/service_impl/ServerServicesImpl";
+import { realEnv } from "server/env";
+import { decodeAvrRecording, AVR_REPLAY_IOC_TOKEN } from "server/avr/AvrRecording";
+import { Timestamp } from "server/misc/Timestamp";
+import TimeService from "server/service/TimeService";
+import DatabaseService from "server/service/DatabaseService";
+import AvrService from "server/service/AvrService";
+import PhSensorService from "server/service/PhSensorService";
+import PhPredictionService from "server/service/PhPredictionService";
+import Co2ControllerService from "server/service/Co2ControllerService";
+import { Co2ClosingState } from "server/service/PhPrediction";
+
+// Replays bytes recorded from AVR (see AKUA_AVR_RECORD and server/avr/AvrRecording.ts) through AvrServiceImpl,
+// PhSensorServiceImpl, PhPredictionServiceImpl and Co2ControllerServiceImpl. Services get time of the recording
+// (all of them use injected TimeService and "scheduler"), so hours of recording take seconds to replay.
+//
+// Usage: npm run replayavr -- <recording> [--speed <1..1000|max>] [--instance <aqua1|aqua2>]
+
+const MAX_SPEED = 1000;
+
+class ReplayTimeService extends TimeService {
+    constructor(private readonly _scheduler: SchedulerLike) {
+        super();
+    }
+
+    nowTimestamp(): Timestamp {
+        const millis = this._scheduler.now();
+        return [Math.floor(millis / 1000), (millis % 1000) * 1_000_000];
+    }
+
+    nowRoundedSeconds(): number {
+        return Math.round(this._scheduler.now() / 1000);
+    }
+}
+
+// Replay must not touch databases, we only count what would be saved
+class ReplayDatabaseService extends DatabaseService {
+    closingStates = 0;
+    captures = 0;
+
+    async insertCo2ClosingState(): Promise<void> {
+        this.closingStates += 1;
+    }
+
+    async markCo2ClosingStatesAsTraining(): Promise<void> {
+    }
+
+    async findCo2ClosingStates(): Promise<Readonly<Co2ClosingState[]>> {
+        return [];
+    }
+
+    async findCo2ClosingTimes(): Promise<number[]> {
+        return [];
+    }
+
+    async countCo2ClosingStates(): Promise<number> {
+        return 0;
+    }
+
+    async insertCo2ValveCapture(): Promise<void> {
+        this.captures += 1;
+    }
+}
+
+function parseArgs(): { fileName: string, speed?: number, instanceName?: string } {
+    const args = process.argv.slice(2);
+    let fileName: string | undefined;
+    let speed: number | undefined = 1;
+    let instanceName = realEnv.instanceName;
+
+    for (let i = 0; i < args.length; i++) {
+        if (args[i] === "--speed") {
+            const value = args[++i];
+            speed = value === "max" ? undefined : Number(value);
+            if (typeof speed !== "undefined" && !(speed >= 1 && speed <= MAX_SPEED)) {
+                throw new Error("Speed must be 1.." + MAX_SPEED + " or 'max'");
+            }
+        } else if (args[i] === "--instance") {
+            instanceName = args[++i];
+        } else {
+            fileName = args[i];
+        }
+    }
+
+    if (!fileName) {
+        throw new Error("Usage: replayavr <recording> [--speed <1.." + MAX_SPEED + "|max>] [--instance <aqua1|aqua2>]");
+    }
+
+    return { fileName, speed, instanceName };
+}
+
+const waitMillis = (millis: number) => new Promise(resolve => setTimeout(resolve, millis));
+const waitEventLoop = () => new Promise(resolve => setImmediate(resolve));
+
+async function replay() {
+    const { fileName, speed, instanceName } = parseArgs();
+    const chunks = decodeAvrRecording(readFileSync(fileName));
+
+    if (!chunks.length) {
+        logger.error("Recording is empty: " + fileName);
+        exit(-2);
+    }
+
+    // Virtual time of the scheduler is unix millis of the recording
+    const scheduler = new VirtualTimeScheduler();
+    scheduler.frame = chunks[0].millis;
+
+    const replay$ = new Subject<Buffer>();
+    const databaseService = new ReplayDatabaseService();
+
+    const container = createNewContainer('avr-replay', { ...realEnv, instanceName });
+    container.bind("scheduler").toConstantValue(scheduler);
+    container.bind(AVR_REPLAY_IOC_TOKEN).toConstantValue(replay$);
+    container.rebind(TimeService).toConstantValue(new ReplayTimeService(scheduler));
+    container.rebind(DatabaseService).toConstantValue(databaseService);
+
+    const avrService = container.get(AvrService);
+    const phSensorService = container.get(PhSensorService);
+    const phPredictionService = container.get(PhPredictionService);
+    container.get(Co2ControllerService);
+
+    let avrStates = 0;
+    let avrEvents = 0;
+    let co2ValveSwitches = 0;
+    let predictions = 0;
+    let lastCo2ValveOpen: boolean | undefined;
+
+    avrService.avrState$.subscribe(avrState => {
+        avrStates += 1;
+        co2ValveSwitches += (typeof lastCo2ValveOpen !== "undefined" && lastCo2ValveOpen !== avrState.co2ValveOpen) ? 1 : 0;
+        lastCo2ValveOpen = avrState.co2ValveOpen;
+    });
+    avrService.avrEvent$.subscribe(() => avrEvents += 1);
+    phPredictionService.minClosingPhPrediction$.subscribe(() => predictions += 1);
+
+    // Timers of services fire up to the time of the chunk, then the chunk is received
+    function advanceTo(millis: number): void {
+        scheduler.maxFrames = millis;
+        scheduler.flush();
+        scheduler.frame = millis;
+    }
+
+    const startedMillis = Date.now();
+    const startedCpu = process.cpuUsage();
+
+    for (const chunk of chunks) {
+        const lagMillis = speed ? startedMillis + (chunk.millis - chunks[0].millis) / speed - Date.now() : 0;
+        await (lagMillis > 0 ? waitMillis(lagMillis) : waitEventLoop());
+
+        advanceTo(chunk.millis);
+        replay$.next(chunk.bytes);
+    }
+
+    await waitEventLoop();
+
+    const cpu = process.cpuUsage(startedCpu);
+    const cpuMillis = (cpu.user + cpu.system) / 1000;
+    const recordedSeconds = (chunks[chunks.length - 1].millis - chunks[0].millis) / 1000;
+    const replayedSeconds = (Date.now() - startedMillis) / 1000;
+    const serviceState = avrService.getServiceState();
+
+    console.log("\n==============================================================");
+    console.log(`Recording: ${fileName}, ${chunks.length} chunks, ${recordedSeconds.toFixed(1)}s`);
+    console.log(`Replayed in ${replayedSeconds.toFixed(1)}s (x${(recordedSeconds / (replayedSeconds || 1)).toFixed(1)})`);
+    console.log(`CPU: ${cpuMillis.toFixed(0)}ms, ${(cpuMillis / (avrStates || 1)).toFixed(3)}ms per AVR state`);
+    console.log(`AVR: states ${avrStates}, events ${avrEvents}, CRC errors ${serviceState.protocolCrcErrors}, trace records ${serviceState.protocolTraceRecords}`);
+    console.log(`CO2: valve switches ${co2ValveSwitches}, predictions ${predictions}, closing states ${databaseService.closingStates}, captures ${databaseService.captures}`);
+    console.log(`PH: last ${phSensorService.ph?.value600s ?? "n/a"} (600s)`);
+
+    exit(0);
+}
+
+// ========================================================================================
+
+replay().catch(error => {
+    logger.error("Replay failed", { error });
+    exit(-1);
+});
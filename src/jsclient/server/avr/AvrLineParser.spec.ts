@@ -0,0 +1,49 @@
+import "reflect-metadata";
+
+import expect from "expect";
+import { AvrLineParser } from "./AvrLineParser";
+import { AVR_STATUS_FRAME_SIZE, avrProtocolVersion, decodeAvrStatusFrame, decodeAvrStatusText, AvrData } from "./protocol";
+import { TEXT_STATUS_SECTIONS, textStatusLine, binaryStatusLine } from "./protocol.testutil";
+
+// Everything is written byte by byte, so every possible split of chunks is there
+function parse(data: Buffer): { statuses: [AvrData, boolean][], lines: string[] } {
+    const statuses: [AvrData, boolean][] = [];
+    const lines: string[] = [];
+    const parser = new AvrLineParser((frame, binary) => statuses.push([decodeAvrStatusFrame(frame), binary]), line => lines.push(line));
+    data.forEach(b => parser.write(Buffer.from([b])));
+    return { statuses, lines };
+}
+
+describe('AvrLineParser', () => {
+    it('should parse text status into binary frame', () => {
+        const { statuses, lines } = parse(Buffer.from(textStatusLine(TEXT_STATUS_SECTIONS) + textStatusLine(TEXT_STATUS_SECTIONS), "latin1"));
+
+        expect(lines).toStrictEqual([]);
+        expect(statuses).toStrictEqual([[decodeAvrStatusText(TEXT_STATUS_SECTIONS), false], [decodeAvrStatusText(TEXT_STATUS_SECTIONS), false]]);
+    });
+
+    it('should parse binary status with escaped bytes', () => {
+        const frame = Buffer.alloc(AVR_STATUS_FRAME_SIZE, 0x0A);
+        frame.writeUInt16LE(avrProtocolVersion, 0);
+        frame.writeUInt32LE(0x0D7D0A0D, 2);
+
+        const { statuses, lines } = parse(Buffer.concat([binaryStatusLine(frame), Buffer.from(textStatusLine(TEXT_STATUS_SECTIONS), "latin1")]));
+
+        expect(lines).toStrictEqual([]);
+        expect(statuses).toStrictEqual([[decodeAvrStatusFrame(frame), true], [decodeAvrStatusText(TEXT_STATUS_SECTIONS), false]]);
+    });
+
+    it('should pass other and broken lines as they are', () => {
+        const broken = textStatusLine(TEXT_STATUS_SECTIONS).replace("A12d", "A12e");
+        const debug = textStatusLine(TEXT_STATUS_SECTIONS).replace("B,,", "B>x>,,");
+        const tooLong = textStatusLine(["A12d,,1ff" + TEXT_STATUS_SECTIONS[0].substr(7), ...TEXT_STATUS_SECTIONS.slice(1)]);
+        const tooShort = textStatusLine([TEXT_STATUS_SECTIONS[0].substr(0, TEXT_STATUS_SECTIONS[0].length - 1), ...TEXT_STATUS_SECTIONS.slice(1)]);
+        const frame = binaryStatusLine(Buffer.alloc(AVR_STATUS_FRAME_SIZE - 1));
+        const lines = ["=1,2,3,4,5,6 7\r\n", broken, debug, tooLong, tooShort, "\r\n"];
+
+        const parsed = parse(Buffer.concat([...lines.map(l => Buffer.from(l, "latin1")), frame]));
+
+        expect(parsed.statuses).toStrictEqual([]);
+        expect(parsed.lines).toStrictEqual([...lines.map(l => l.replace("\n", "")), frame.slice(0, frame.length - 1).toString("latin1")]);
+    });
+});
@@ -0,0 +1,293 @@
+import { AVR_PROTOCOL_ESCAPE, AVR_STATUS_FRAME_SIZE, AVR_STATUS_LAYOUT } from "./protocol";
+
+// Splits bytes from AVR into lines and parses status lines (text and binary ones) on the fly, byte by byte,
+// straight into one preallocated binary status frame: no strings, no intermediate objects, CRC is updated
+// with every byte. Both kinds of status end up in the same frame layout, so decodeAvrStatusFrame reads them.
+//
+// Everything else (time sync replies, events, capture chunks, trace records, broken status lines) goes
+// to onLine as a string, just like lines of a readline parser.
+
+// Maxim CRC8 (polynomial 0x8C, reflected), the same as in the firmware
+const CRC_TABLE = (() => {
+    const table = new Uint8Array(256);
+    for (let i = 0; i < 256; i++) {
+        let crc = i;
+        for (let j = 0; j < 8; j++) {
+            crc = (crc & 1) ? (crc >> 1) ^ 0x8C : crc >> 1;
+        }
+        table[i] = crc;
+    }
+    return table;
+})();
+
+export function addAvrCrc(crc: number, byte: number): number {
+    return CRC_TABLE[(crc ^ byte) & 0xFF];
+}
+
+// -1 if it's not a hex digit
+const HEX_DIGITS = (() => {
+    const digits = new Int8Array(256).fill(-1);
+    for (let i = 0; i < 16; i++) {
+        digits["0123456789abcdef".charCodeAt(i)] = i;
+        digits["0123456789ABCDEF".charCodeAt(i)] = i;
+    }
+    return digits;
+})();
+
+const LF = 0x0A;
+const CR = 0x0D;
+const SPACE = 0x20;
+const HASH = 0x23;
+const COMMA = 0x2C;
+
+// Text status has u16 version and u8 CRC after sections
+const VERSION_DIGITS = 4;
+const CRC_DIGITS = 2;
+
+const INITIAL_LINE_SIZE = 256;
+
+enum LineMode {
+    // Nothing received after the previous \n
+    Start,
+    // " A1,,2 B... version crc"
+    Text,
+    // "#" followed by escaped frame
+    Binary,
+    // Anything else, it's only collected for onLine
+    Other
+}
+
+export class AvrLineParser {
+    // Version, fields and CRC (binary status only)
+    private readonly _frame = Buffer.alloc(AVR_STATUS_FRAME_SIZE + 1);
+
+    // Raw bytes of the current line, they are only needed if it's not a valid status
+    private _line = Buffer.alloc(INITIAL_LINE_SIZE);
+    private _lineLength = 0;
+
+    private _mode = LineMode.Start;
+    private _crc = 0;
+
+    // Text status: index of section (sections.length is version, sections.length + 1 is CRC),
+    // index of field in the section (-1 until we get the section id) and hex value being parsed
+    private _section = 0;
+    private _field = -1;
+    private _value = 0;
+    private _digits = 0;
+    private _crcOfSubject = 0;
+
+    // Binary status: position in the frame and whether the previous byte was escape
+    private _position = 0;
+    private _escaped = false;
+
+    // Layout of sections of text status, fields of section s are _firstFields[s].._firstFields[s + 1] - 1
+    private readonly _sectionIds = new Uint8Array(AVR_STATUS_LAYOUT.map(s => s.id.charCodeAt(0)));
+    private readonly _firstFields = new Uint16Array(AVR_STATUS_LAYOUT.length + 1);
+    private readonly _offsets = new Uint16Array(([] as number[]).concat(...AVR_STATUS_LAYOUT.map(s => s.offsets)));
+    private readonly _sizes = new Uint8Array(([] as number[]).concat(...AVR_STATUS_LAYOUT.map(s => s.sizes)));
+
+    // Frame given to onStatus is reused, it's valid only until onStatus returns
+    constructor(
+        private readonly _onStatus: (frame: Buffer, binary: boolean) => void,
+        private readonly _onLine: (line: string) => void
+    ) {
+        AVR_STATUS_LAYOUT.forEach((s, i) => this._firstFields[i + 1] = this._firstFields[i] + s.offsets.length);
+    }
+
+    write(chunk: Buffer): void {
+        for (let i = 0; i < chunk.length; i++) {
+            const b = chunk[i];
+
+            if (b === LF) {
+                this._endLine();
+                continue;
+            }
+
+            this._pushLineByte(b);
+
+            switch (this._mode) {
+                case LineMode.Start:
+                    this._startLine(b);
+                    break;
+                case LineMode.Text:
+                    this._onTextByte(b);
+                    break;
+                case LineMode.Binary:
+                    this._onBinaryByte(b);
+                    break;
+            }
+        }
+    }
+
+    private _pushLineByte(b: number): void {
+        if (this._lineLength === this._line.length) {
+            const line = Buffer.alloc(this._line.length * 2);
+            this._line.copy(line);
+            this._line = line;
+        }
+
+        this._line[this._lineLength++] = b;
+    }
+
+    private _startLine(b: number): void {
+        if (b === SPACE) {
+            this._mode = LineMode.Text;
+            this._crc = CRC_TABLE[b];
+            this._section = 0;
+            this._field = -1;
+        } else if (b === HASH) {
+            this._mode = LineMode.Binary;
+            this._crc = 0;
+            this._position = 0;
+            this._escaped = false;
+        } else {
+            this._mode = LineMode.Other;
+        }
+    }
+
+    private _onTextByte(b: number): void {
+        if (b === CR) {
+            return;
+        }
+
+        const sections = this._sectionIds.length;
+
+        // CRC is of everything up to the space before it
+        if (this._section > sections) {
+            this._addDigit(b, CRC_DIGITS);
+            return;
+        }
+
+        this._crc = CRC_TABLE[this._crc ^ b];
+
+        if (this._section === sections) {
+            if (b !== SPACE) {
+                this._addDigit(b, VERSION_DIGITS);
+                return;
+            }
+
+            this._frame[0] = this._value;
+            this._frame[1] = this._value >>> 8;
+            this._crcOfSubject = this._crc;
+            this._section += 1;
+            this._value = 0;
+            this._digits = 0;
+            return;
+        }
+
+        if (this._field < 0) {
+            if (b !== this._sectionIds[this._section]) {
+                this._mode = LineMode.Other;
+                return;
+            }
+
+            this._field = 0;
+            this._value = 0;
+            this._digits = 0;
+            return;
+        }
+
+        const field = this._firstFields[this._section] + this._field;
+        const nextSectionField = this._firstFields[this._section + 1];
+
+        if (field >= nextSectionField) {
+            this._mode = LineMode.Other;
+            return;
+        }
+
+        if (b !== COMMA && b !== SPACE) {
+            // Value must fit into its field
+            this._addDigit(b, this._sizes[field] * 2);
+            return;
+        }
+
+        this._storeField(field, this._value);
+        this._value = 0;
+        this._digits = 0;
+
+        if (b === COMMA) {
+            this._field += 1;
+        } else if (field + 1 === nextSectionField) {
+            this._section += 1;
+            this._field = -1;
+        } else {
+            // Not enough fields
+            this._mode = LineMode.Other;
+        }
+    }
+
+    private _addDigit(b: number, maxDigits: number): void {
+        const digit = HEX_DIGITS[b];
+
+        if (digit < 0 || this._digits === maxDigits) {
+            this._mode = LineMode.Other;
+            return;
+        }
+
+        this._value = this._value * 16 + digit;
+        this._digits += 1;
+    }
+
+    // Little endian, like in binary status
+    private _storeField(field: number, value: number): void {
+        const offset = this._offsets[field];
+        const size = this._sizes[field];
+
+        this._frame[offset] = value;
+        if (size > 1) {
+            this._frame[offset + 1] = value >>> 8;
+        }
+        if (size > 2) {
+            this._frame[offset + 2] = value >>> 16;
+            this._frame[offset + 3] = value >>> 24;
+        }
+    }
+
+    // Escaped frame has no \r, it's the end of the line
+    private _onBinaryByte(b: number): void {
+        if (b === CR) {
+            return;
+        }
+
+        if (this._escaped) {
+            b ^= 0x20;
+            this._escaped = false;
+        } else if (b === AVR_PROTOCOL_ESCAPE) {
+            this._escaped = true;
+            return;
+        }
+
+        if (this._position > AVR_STATUS_FRAME_SIZE) {
+            this._mode = LineMode.Other;
+            return;
+        }
+
+        if (this._position < AVR_STATUS_FRAME_SIZE) {
+            this._crc = CRC_TABLE[this._crc ^ b];
+        }
+
+        this._frame[this._position++] = b;
+    }
+
+    private _endLine(): void {
+        if (this._isValidStatus()) {
+            this._onStatus(this._frame, this._mode === LineMode.Binary);
+        } else {
+            this._onLine(this._line.toString("latin1", 0, this._lineLength));
+        }
+
+        this._mode = LineMode.Start;
+        this._lineLength = 0;
+    }
+
+    private _isValidStatus(): boolean {
+        switch (this._mode) {
+            case LineMode.Text:
+                return this._section === this._sectionIds.length + 1 && this._value === this._crcOfSubject;
+            case LineMode.Binary:
+                return this._position === AVR_STATUS_FRAME_SIZE + 1 && !this._escaped && this._crc === this._frame[AVR_STATUS_FRAME_SIZE];
+            default:
+                return false;
+        }
+    }
+}
@@ -0,0 +1,61 @@
+import "reflect-metadata";
+
+import expect from "expect";
+import { join } from "path";
+import { tmpdir } from "os";
+import { AvrRecordingEncoder, AvrRecorder, decodeAvrRecording, AVR_RECORDING_MAGIC } from "./AvrRecording";
+
+const T0 = 1600000000123;
+
+function record(encoder: AvrRecordingEncoder, chunks: [number, string][]): Buffer[] {
+    return chunks.map(([millis, text]) => encoder.encode(millis, Buffer.from(text, "ascii")));
+}
+
+function asTexts(data: Buffer): [number, string][] {
+    return decodeAvrRecording(data).map(c => [c.millis, c.bytes.toString("ascii")]);
+}
+
+describe('AvrRecording', () => {
+    it('should decode what was recorded', () => {
+        const chunks: [number, string][] = [[T0, " A1,2"], [T0 + 5, ",3 B"], [T0 + 100000, " 6a 1f\r\n"]];
+        const data = Buffer.concat([AVR_RECORDING_MAGIC, ...record(new AvrRecordingEncoder(), chunks)]);
+
+        expect(asTexts(data)).toStrictEqual(chunks);
+
+        // Time reset once, then up to 4 bytes of header per chunk
+        expect(data.length).toBeLessThanOrEqual(AVR_RECORDING_MAGIC.length + 10 + 3 * 4 + 17);
+    });
+
+    it('should decode appended sessions and clock adjustments', () => {
+        const first: [number, string][] = [[T0, "a"], [T0 - 1000, "b"]];
+        const second: [number, string][] = [[T0 + 5000, "c"], [T0 + 5001, "d"]];
+        const data = Buffer.concat([
+            AVR_RECORDING_MAGIC,
+            ...record(new AvrRecordingEncoder(), first),
+            ...record(new AvrRecordingEncoder(), second)
+        ]);
+
+        expect(asTexts(data)).toStrictEqual([...first, ...second]);
+    });
+
+    it('should ignore incomplete record at the end', () => {
+        const data = Buffer.concat([AVR_RECORDING_MAGIC, ...record(new AvrRecordingEncoder(), [[T0, "abc"], [T0 + 1, "def"]])]);
+
+        expect(asTexts(data.slice(0, data.length - 1))).toStrictEqual([[T0, "abc"]]);
+        expect(() => decodeAvrRecording(Buffer.from("garbage"))).toThrow();
+    });
+
+    it('should skip empty chunks', () => {
+        const data = Buffer.concat([AVR_RECORDING_MAGIC, ...record(new AvrRecordingEncoder(), [[T0, "abc"], [T0 + 1, ""], [T0 + 2, "def"]])]);
+
+        expect(asTexts(data)).toStrictEqual([[T0, "abc"], [T0 + 2, "def"]]);
+    });
+
+    it('should stop recording if the file can\'t be written', async () => {
+        const recorder = new AvrRecorder(join(tmpdir(), "no-such-dir-" + process.pid, "avr.rec"));
+
+        // Open fails asynchronously, without a listener its 'error' would kill the process
+        await new Promise(resolve => setTimeout(resolve, 100));
+        recorder.add(T0, Buffer.from("abc", "ascii"));
+    });
+});
@@ -0,0 +1,141 @@
+import { createWriteStream, existsSync, statSync, WriteStream } from "fs";
+import logger from "server/logger";
+
+// Recording of raw bytes we receive from AVR, so the whole stream can be replayed through our services
+// (see cli-utils/replayavr.ts).
+//
+// File starts with AVR_RECORDING_MAGIC followed by records:
+//   varint millis since the previous record, varint length, bytes
+// Record with zero length is a time reset, it's followed by absolute unix millis (f64, little endian).
+// Every recording session starts with a time reset, so sessions can be appended to the same file.
+
+export const AVR_RECORDING_MAGIC = Buffer.from("AKUAREC1", "ascii");
+
+// Bind an Observable<Buffer> of recorded bytes to this token to make AvrServiceImpl replay them
+// instead of opening the serial port
+export const AVR_REPLAY_IOC_TOKEN = Symbol("avrReplay");
+
+export interface AvrRecordedChunk {
+    readonly millis: number;
+    readonly bytes: Buffer;
+}
+
+function pushVarint(out: number[], v: number): void {
+    while (v >= 0x80) {
+        out.push((v & 0x7F) | 0x80);
+        v = Math.floor(v / 0x80);
+    }
+    out.push(v);
+}
+
+export class AvrRecordingEncoder {
+    private _lastMillis?: number;
+
+    // Time goes back if our clock is adjusted, so it's a time reset as well.
+    // Empty chunk isn't recorded at all, a record with zero length would be read as a time reset.
+    encode(millis: number, bytes: Buffer): Buffer {
+        if (!bytes.length) {
+            return Buffer.alloc(0);
+        }
+
+        const header: number[] = [];
+        millis = Math.round(millis);
+
+        if (typeof this._lastMillis === "undefined" || millis < this._lastMillis) {
+            const reset = Buffer.alloc(8);
+            reset.writeDoubleLE(millis, 0);
+            pushVarint(header, 0);
+            pushVarint(header, 0);
+            header.push(...reset);
+            pushVarint(header, 0);
+        } else {
+            pushVarint(header, millis - this._lastMillis);
+        }
+
+        this._lastMillis = millis;
+        pushVarint(header, bytes.length);
+
+        return Buffer.concat([Buffer.from(header), bytes]);
+    }
+}
+
+// Incomplete record at the end (we were killed while writing it) is ignored
+export function decodeAvrRecording(data: Buffer): AvrRecordedChunk[] {
+    if (data.length < AVR_RECORDING_MAGIC.length || !data.slice(0, AVR_RECORDING_MAGIC.length).equals(AVR_RECORDING_MAGIC)) {
+        throw new Error("Not an AVR recording");
+    }
+
+    const chunks: AvrRecordedChunk[] = [];
+    let pos = AVR_RECORDING_MAGIC.length;
+    let millis: number | undefined;
+
+    function readVarint(): number | undefined {
+        let v = 0;
+        for (let scale = 1; pos < data.length; scale *= 0x80) {
+            const b = data[pos++];
+            v += (b & 0x7F) * scale;
+            if (!(b & 0x80)) {
+                return v;
+            }
+        }
+        return undefined;
+    }
+
+    while (pos < data.length) {
+        const delta = readVarint();
+        const length = readVarint();
+
+        if (typeof delta === "undefined" || typeof length === "undefined") {
+            break;
+        }
+
+        if (!length) {
+            if (pos + 8 > data.length) {
+                break;
+            }
+            millis = data.readDoubleLE(pos);
+            pos += 8;
+            continue;
+        }
+
+        if (typeof millis === "undefined") {
+            throw new Error("AVR recording has data before the first time reset");
+        }
+
+        if (pos + length > data.length) {
+            break;
+        }
+
+        millis += delta;
+        chunks.push({ millis, bytes: data.slice(pos, pos + length) });
+        pos += length;
+    }
+
+    return chunks;
+}
+
+// Appends to the file if it exists. Recording stops on the first write error (e.g. disk is full),
+// AVR communication goes on without it.
+export class AvrRecorder {
+    private readonly _encoder = new AvrRecordingEncoder();
+    private _stream?: WriteStream;
+
+    constructor(fileName: string) {
+        const isNew = !existsSync(fileName) || statSync(fileName).size === 0;
+        const stream = createWriteStream(fileName, { flags: "a" });
+        this._stream = stream;
+
+        stream.on("error", error => {
+            logger.error("AVR recording: Can't write, recording stopped", { fileName, error });
+            this._stream = undefined;
+        });
+
+        if (isNew) {
+            stream.write(AVR_RECORDING_MAGIC);
+        }
+    }
+
+    add(millis: number, bytes: Buffer): void {
+        this._stream?.write(this._encoder.encode(millis, bytes));
+    }
+}
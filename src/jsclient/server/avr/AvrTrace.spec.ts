@@ -0,0 +1,37 @@
+import "reflect-metadata";
+
+import expect from "expect";
+import { decodeAvrTraceLine } from "./AvrTrace";
+import { calcTestCrc, escapeTestFrame } from "./protocol.testutil";
+
+// The same way the firmware writes it
+function traceLine(data: Buffer): string {
+    return Buffer.concat([Buffer.from([0x25]), escapeTestFrame([...data, calcTestCrc(data)])]).toString("latin1");
+}
+
+describe('AvrTrace', () => {
+    it('should decode records with args and unwrapped periods', () => {
+        const data = Buffer.from([
+            0x0D, 0x00, 0x01, 0x00,                         // periods 0x1000D
+            0x01, 0xF0, 0xFF, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,   // ClockCorrected(-5, -16) at 0xFFF0
+            0x04, 0x0A, 0x00, 0x03, 0x01, 0x64, 0x19        // PhSafetyLockout(1, 6500) at 0x1000A, 3 dropped
+        ]);
+
+        expect(decodeAvrTraceLine(traceLine(data))).toStrictEqual({
+            periods: 0x1000D,
+            records: [
+                { name: "ClockCorrected", periods: 0xFFF0, dropped: 0, args: { driftDeciseconds: -5, trimPpmX8: -16 } },
+                { name: "PhSafetyLockout", periods: 0x1000A, dropped: 3, args: { lockout: 1, milliPh: 6500 } }
+            ]
+        });
+    });
+
+    it('should reject broken lines', () => {
+        const data = Buffer.from([0x0D, 0x00, 0x00, 0x00, 0x02, 0x0A, 0x00, 0x00, 0x01, 0x07]);
+
+        expect(decodeAvrTraceLine(traceLine(data))).toBeDefined();
+        expect(decodeAvrTraceLine(traceLine(data.slice(0, data.length - 1)))).toBeUndefined();
+        expect(decodeAvrTraceLine(traceLine(Buffer.concat([data, Buffer.from([0xFF, 0, 0, 0])])))).toBeUndefined();
+        expect(decodeAvrTraceLine(traceLine(data).replace("\x07", "\x08"))).toBeUndefined();
+    });
+});
@@ -0,0 +1,86 @@
+import { AVR_TRACEPOINTS, AvrTraceArgType, unescapeAvrStatusFrame } from "./protocol";
+import { addAvrCrc } from "./AvrLineParser";
+
+// Decodes trace lines of the firmware (see 'Tracing' in main.c and tracepoints in protocol.json):
+// %periods record1 ... recordN crc, binary and escaped like binary status.
+
+export interface AvrTraceRecord {
+    // Name of the tracepoint from protocol.json
+    readonly name: string;
+
+    // timer1_periods (deciseconds since AVR start) when the record was written
+    readonly periods: number;
+
+    // Records of the tracepoint dropped (rate limit or full trace buffer) since the previous one
+    readonly dropped: number;
+
+    readonly args: { readonly [name: string]: number };
+}
+
+export interface AvrTraceLine {
+    // timer1_periods when the line was written
+    readonly periods: number;
+    readonly records: AvrTraceRecord[];
+}
+
+// Record header: u8 id, u16 periods (low bits), u8 dropped
+const RECORD_HEADER_SIZE = 4;
+const PERIODS_SIZE = 4;
+
+const ARG_READERS: { readonly [type in AvrTraceArgType]: (data: Buffer, offset: number) => number } = {
+    u8: (data, offset) => data.readUInt8(offset),
+    u16: (data, offset) => data.readUInt16LE(offset),
+    u32: (data, offset) => data.readUInt32LE(offset),
+    i16: (data, offset) => data.readInt16LE(offset),
+    i32: (data, offset) => data.readInt32LE(offset)
+};
+
+const ARG_SIZES: { readonly [type in AvrTraceArgType]: number } = { u8: 1, u16: 2, u32: 4, i16: 2, i32: 4 };
+
+// Returns undefined if the line is broken (wrong CRC, unknown tracepoint, truncated record)
+export function decodeAvrTraceLine(line: string): AvrTraceLine | undefined {
+    const data = unescapeAvrStatusFrame(Buffer.from(line.substr(1), "latin1"));
+
+    if (data.length < PERIODS_SIZE + 1) {
+        return undefined;
+    }
+
+    let crc = 0;
+    for (let i = 0; i < data.length - 1; i++) {
+        crc = addAvrCrc(crc, data[i]);
+    }
+
+    if (crc !== data[data.length - 1]) {
+        return undefined;
+    }
+
+    const end = data.length - 1;
+    const periods = data.readUInt32LE(0);
+    const records: AvrTraceRecord[] = [];
+
+    for (let offset = PERIODS_SIZE; offset < end;) {
+        const tracepoint = AVR_TRACEPOINTS[data[offset] - 1];
+        if (!tracepoint || offset + RECORD_HEADER_SIZE > end) {
+            return undefined;
+        }
+
+        // Records are older than the line, so only low bits of their periods are sent
+        const recordPeriods = periods - ((periods - data.readUInt16LE(offset + 1)) & 0xFFFF);
+        const dropped = data[offset + 3];
+        offset += RECORD_HEADER_SIZE;
+
+        const args: { [name: string]: number } = {};
+        for (const arg of tracepoint.args) {
+            if (offset + ARG_SIZES[arg.type] > end) {
+                return undefined;
+            }
+
+            args[arg.name] = ARG_READERS[arg.type](data, offset);
+            offset += ARG_SIZES[arg.type];
+        }
+
+        records.push({ name: tracepoint.name, periods: recordPeriods, dropped, args });
+    }
+
+    return { periods, records };
+}
@@ -0,0 +1,95 @@
+import "reflect-metadata";
+
+import expect from "expect";
+import { calcTimeSyncSample, TimeSyncEstimator, TimeSyncReply, SERIAL_BYTE_SECONDS, AVR_TICKS_PER_PERIOD, asAvrSeconds } from "./TimeSync";
+
+const utcSecondsSinceMidnight = (unixSeconds: number) => unixSeconds % (24 * 60 * 60);
+
+function asPeriodsAndTicks(avrSeconds: number): [number, number] {
+    const periods = Math.floor(avrSeconds * 10);
+    return [periods, Math.round((avrSeconds * 10 - periods) * AVR_TICKS_PER_PERIOD)];
+}
+
+// AVR time is host time + offset, delays are symmetric
+function createReply({ offset, sentSeconds, stampBytes, latency, processing, bytes, txClockDeciseconds }: {
+    offset: number,
+    sentSeconds: number,
+    stampBytes: number,
+    latency: number,
+    processing: number,
+    bytes: number,
+    txClockDeciseconds: number
+}): TimeSyncReply {
+    const rx = sentSeconds + stampBytes * SERIAL_BYTE_SECONDS + latency + offset;
+    const [rxPeriods, rxTicks] = asPeriodsAndTicks(rx);
+    const [txPeriods, txTicks] = asPeriodsAndTicks(rx + processing);
+    const tx = asAvrSeconds(txPeriods, txTicks);
+
+    return {
+        seq: 1, rxPeriods, rxTicks, txPeriods, txTicks, txClockDeciseconds,
+        receivedSeconds: tx - offset + latency + bytes * SERIAL_BYTE_SECONDS,
+        bytes
+    };
+}
+
+describe('TimeSync', () => {
+    it('should compensate serial transmission and symmetric delays', () => {
+        const request = { seq: 1, sentSeconds: 100, stampBytes: 4 };
+        const reply = createReply({ offset: 1000.03, sentSeconds: 100, stampBytes: 4, latency: 0.01, processing: 0.05, bytes: 30, txClockDeciseconds: 1000 });
+
+        const sample = calcTimeSyncSample(request, reply, utcSecondsSinceMidnight);
+
+        expect(sample.offsetSeconds).toBeCloseTo(1000.03, 5);
+        expect(sample.rttSeconds).toBeCloseTo(0.02, 5);
+
+        // AVR clock (seconds since midnight) when the reply was sent vs our clock at that moment
+        const txAvrClock = (reply.txClockDeciseconds + reply.txTicks / AVR_TICKS_PER_PERIOD) / 10;
+        const txHostClock = asAvrSeconds(reply.txPeriods, reply.txTicks) - 1000.03;
+        expect(sample.clockOffsetSeconds).toBeCloseTo(txAvrClock - txHostClock, 5);
+    });
+
+    it('should use the sample with the smallest round-trip time', () => {
+        const estimator = new TimeSyncEstimator(utcSecondsSinceMidnight);
+
+        expect(estimator.add({ offsetSeconds: 1, rttSeconds: 0.05, clockOffsetSeconds: 0 })).toStrictEqual(true);
+        expect(estimator.add({ offsetSeconds: 2, rttSeconds: 0.01, clockOffsetSeconds: 0 })).toStrictEqual(true);
+        expect(estimator.add({ offsetSeconds: 3, rttSeconds: 0.03, clockOffsetSeconds: 0 })).toStrictEqual(true);
+        expect(estimator.add({ offsetSeconds: 4, rttSeconds: -0.01, clockOffsetSeconds: 0 })).toStrictEqual(false);
+
+        expect(estimator.getSamplesCount()).toStrictEqual(3);
+        expect(estimator.getBest()?.offsetSeconds).toStrictEqual(2);
+
+        estimator.reset();
+        expect(estimator.getBest()).toStrictEqual(undefined);
+    });
+
+    it('should delay AVR deciseconds that start too early', () => {
+        const estimator = new TimeSyncEstimator(utcSecondsSinceMidnight);
+
+        // AVR deciseconds start 30ms before ours
+        estimator.add({ offsetSeconds: 1000.03, rttSeconds: 0.02, clockOffsetSeconds: 0 });
+        expect(estimator.getPhaseAdjustment()).toStrictEqual(77);
+
+        // AVR deciseconds start 20ms after ours
+        estimator.reset();
+        estimator.add({ offsetSeconds: 999.98, rttSeconds: 0.02, clockOffsetSeconds: 0 });
+        expect(estimator.getPhaseAdjustment()).toStrictEqual(-51);
+
+        // Aligned
+        estimator.reset();
+        estimator.add({ offsetSeconds: 1000.0002, rttSeconds: 0.02, clockOffsetSeconds: 0 });
+        expect(estimator.getPhaseAdjustment()).toStrictEqual(undefined);
+    });
+
+    it('should send clock that is correct at the decisecond it is applied', () => {
+        const estimator = new TimeSyncEstimator(utcSecondsSinceMidnight);
+        expect(estimator.getClockToSend(1000.05, 0)).toStrictEqual(undefined);
+
+        // Clock arrives at 1000.06 (our time), it's applied at the next AVR decisecond at 1000.1 (our time)
+        estimator.add({ offsetSeconds: 1000, rttSeconds: 0.02, clockOffsetSeconds: 0 });
+        expect(estimator.getClockToSend(1000.05, 0)).toStrictEqual(10001);
+
+        // Serial transmission makes it arrive after 1000.1
+        expect(estimator.getClockToSend(1000.05, 60)).toStrictEqual(10002);
+    });
+});
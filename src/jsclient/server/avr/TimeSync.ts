@@ -0,0 +1,164 @@
+// NTP-like time synchronization with AVR.
+//
+// Host sends <Tseq Tseq> and AVR stamps reception of the second 'T' byte, then it replies with
+// a line that starts with '=' and stamps transmission of that byte. Stamps are in Timer1 periods
+// (deciseconds) and ticks. Serial transmission time of the bytes before the stamps is known (9600 baud),
+// so it's compensated and the rest of the delays is assumed to be symmetric.
+
+// Must be in harmony with AK_TIMER1_NOMINAL_TOP and AK_TIME_SYNC_* in the firmware!
+export const AVR_PERIOD_SECONDS = 0.1;
+export const AVR_TICKS_PER_PERIOD = 25000;
+export const AVR_PHASE_UNIT_TICKS = 98;
+export const AVR_MAX_PHASE_UNITS = 127;
+
+// 8 data bits + start bit + stop bit at 9600 baud
+export const SERIAL_BYTE_SECONDS = 10 / 9600;
+
+const AVR_PHASE_UNIT_SECONDS = AVR_PHASE_UNIT_TICKS / AVR_TICKS_PER_PERIOD * AVR_PERIOD_SECONDS;
+
+const SECONDS_IN_DAY = 24 * 60 * 60;
+
+// Samples with larger round-trip time are not used at all
+const MAX_RTT_SECONDS = 1;
+
+// Number of recent samples we choose the best one from
+const MAX_SAMPLES = 8;
+
+// Phase is not adjusted if it's off by less than this number of units
+const MIN_PHASE_ADJUSTMENT_UNITS = 2;
+
+// AVR needs some time to process clock commands before they can be applied at a decisecond boundary
+const CLOCK_APPLY_MARGIN_SECONDS = 0.02;
+
+export interface TimeSyncRequest {
+    readonly seq: number;
+    // Host time (unix seconds) when the request was written
+    readonly sentSeconds: number;
+    // Number of bytes written up to (and including) the stamped 'T' byte
+    readonly stampBytes: number;
+}
+
+export interface TimeSyncReply {
+    readonly seq: number;
+    readonly rxPeriods: number;
+    readonly rxTicks: number;
+    readonly txPeriods: number;
+    readonly txTicks: number;
+    readonly txClockDeciseconds: number;
+    // Host time (unix seconds) when the whole reply line was received
+    readonly receivedSeconds: number;
+    // Number of bytes of the reply line including '\r\n'
+    readonly bytes: number;
+}
+
+export interface TimeSyncSample {
+    // AVR time (seconds since AVR start) minus host time
+    readonly offsetSeconds: number;
+    readonly rttSeconds: number;
+    // AVR clock minus host clock, both as seconds since midnight
+    readonly clockOffsetSeconds: number;
+}
+
+export function asAvrSeconds(periods: number, ticks: number): number {
+    return (periods + ticks / AVR_TICKS_PER_PERIOD) * AVR_PERIOD_SECONDS;
+}
+
+// AVR clock runs in local time (time zones are whole minutes, so fraction of second is the same)
+export function asLocalSecondsSinceMidnight(unixSeconds: number): number {
+    const d = new Date(Math.floor(unixSeconds) * 1000);
+    return (d.getHours() * 60 + d.getMinutes()) * 60 + d.getSeconds() + (unixSeconds - Math.floor(unixSeconds));
+}
+
+export function calcTimeSyncSample(
+    request: TimeSyncRequest,
+    reply: TimeSyncReply,
+    secondsSinceMidnight: (unixSeconds: number) => number = asLocalSecondsSinceMidnight): TimeSyncSample {
+
+    const t1 = request.sentSeconds + request.stampBytes * SERIAL_BYTE_SECONDS;
+    const t2 = asAvrSeconds(reply.rxPeriods, reply.rxTicks);
+    const t3 = asAvrSeconds(reply.txPeriods, reply.txTicks);
+    const t4 = reply.receivedSeconds - reply.bytes * SERIAL_BYTE_SECONDS;
+
+    const offsetSeconds = ((t2 - t1) + (t3 - t4)) / 2;
+    const rttSeconds = (t4 - t1) - (t3 - t2);
+
+    const avrClockSeconds = (reply.txClockDeciseconds + reply.txTicks / AVR_TICKS_PER_PERIOD) * AVR_PERIOD_SECONDS;
+    let clockOffsetSeconds = (avrClockSeconds - secondsSinceMidnight(t3 - offsetSeconds)) % SECONDS_IN_DAY;
+    if (clockOffsetSeconds > SECONDS_IN_DAY / 2) {
+        clockOffsetSeconds -= SECONDS_IN_DAY;
+    } else if (clockOffsetSeconds <= -SECONDS_IN_DAY / 2) {
+        clockOffsetSeconds += SECONDS_IN_DAY;
+    }
+
+    return { offsetSeconds, rttSeconds, clockOffsetSeconds };
+}
+
+// Keeps recent samples and uses the one with the smallest round-trip time (it has the smallest error)
+export class TimeSyncEstimator {
+    private _samples: TimeSyncSample[] = [];
+
+    constructor(private readonly _secondsSinceMidnight: (unixSeconds: number) => number = asLocalSecondsSinceMidnight) {
+    }
+
+    add(sample: TimeSyncSample): boolean {
+        if (sample.rttSeconds < 0 || sample.rttSeconds > MAX_RTT_SECONDS) {
+            return false;
+        }
+
+        this._samples.push(sample);
+        if (this._samples.length > MAX_SAMPLES) {
+            this._samples.shift();
+        }
+
+        return true;
+    }
+
+    // Must be called when AVR time is changed (i.e. phase is adjusted)
+    reset(): void {
+        this._samples = [];
+    }
+
+    getSamplesCount(): number {
+        return this._samples.length;
+    }
+
+    getBest(): TimeSyncSample | undefined {
+        return this._samples.reduce<TimeSyncSample | undefined>((best, s) => (!best || s.rttSeconds < best.rttSeconds) ? s : best, undefined);
+    }
+
+    // Returns signed number of units AVR's next period must be made longer by, so that AVR deciseconds
+    // start when host deciseconds start. Returns undefined if there is nothing to adjust.
+    getPhaseAdjustment(): number | undefined {
+        const best = this.getBest();
+        if (!best) {
+            return undefined;
+        }
+
+        // AVR periods start at host times k * period - offset
+        let phase = (-best.offsetSeconds) % AVR_PERIOD_SECONDS;
+        if (phase > AVR_PERIOD_SECONDS / 2) {
+            phase -= AVR_PERIOD_SECONDS;
+        } else if (phase <= -AVR_PERIOD_SECONDS / 2) {
+            phase += AVR_PERIOD_SECONDS;
+        }
+
+        // AVR periods start later than ours, so the next one must be shorter
+        const units = Math.max(-AVR_MAX_PHASE_UNITS, Math.min(AVR_MAX_PHASE_UNITS, Math.round(-phase / AVR_PHASE_UNIT_SECONDS)));
+        return Math.abs(units) >= MIN_PHASE_ADJUSTMENT_UNITS ? units : undefined;
+    }
+
+    // Returns clock (deciseconds since midnight) that is correct at AVR's decisecond boundary
+    // when it's going to be applied. Clock is applied at the first boundary after AVR receives it.
+    getClockToSend(nowSeconds: number, bytesBeforeApplied: number): number | undefined {
+        const best = this.getBest();
+        if (!best) {
+            return undefined;
+        }
+
+        const arrivalSeconds = nowSeconds + bytesBeforeApplied * SERIAL_BYTE_SECONDS + best.rttSeconds / 2;
+        const period = Math.floor((arrivalSeconds + best.offsetSeconds + CLOCK_APPLY_MARGIN_SECONDS) / AVR_PERIOD_SECONDS) + 1;
+        const appliedSeconds = period * AVR_PERIOD_SECONDS - best.offsetSeconds;
+
+        return Math.round(this._secondsSinceMidnight(appliedSeconds) / AVR_PERIOD_SECONDS) % (SECONDS_IN_DAY * 10);
+    }
+}
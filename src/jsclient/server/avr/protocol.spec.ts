@@ -0,0 +1,48 @@
+import "reflect-metadata";
+
+import expect from "expect";
+import { AVR_PROTOCOL_ESCAPE, AVR_STATUS_FRAME_SIZE, avrProtocolVersion, decodeAvrStatusFrame, decodeAvrStatusText, unescapeAvrStatusFrame } from "./protocol";
+import { TEXT_STATUS_SECTIONS, escapeTestFrame } from "./protocol.testutil";
+
+describe('protocol', () => {
+    it('should decode the same data from text and binary status', () => {
+        const frame = Buffer.alloc(AVR_STATUS_FRAME_SIZE);
+        frame.writeUInt16LE(avrProtocolVersion, 0);
+        frame.writeUInt32LE(0x12d, 2);
+        frame.writeUInt8(1, 7);
+        frame.writeUInt32LE(0xe, 8);
+        frame.writeInt32LE(-5, 12);
+        frame.writeInt16LE(-16, 20);
+        frame.writeUInt32LE(0xd2f0, 22);
+        frame.writeUInt8(1, 28);
+        frame.writeUInt16LE(0x190, 32);
+        frame.writeUInt8(1, 34);
+        frame.writeUInt16LE(0x1a0, 38);
+        frame.writeUInt8(2, 40);
+
+        const fromText = decodeAvrStatusText(TEXT_STATUS_SECTIONS);
+        const fromFrame = decodeAvrStatusFrame(unescapeAvrStatusFrame(escapeTestFrame(frame)));
+
+        expect(fromFrame).toStrictEqual(fromText);
+        expect(fromFrame.uptimeSeconds).toBe(30.1);
+        expect(fromFrame.clockDriftSeconds).toBe(-0.5);
+        expect(fromFrame.clockTrimPpm).toBe(-2);
+        expect(fromFrame.aquaTemperature).toBe(25);
+        expect(fromFrame.caseTemperature).toBe(26);
+    });
+
+    it('should unescape bytes that would break lines', () => {
+        const frame = Buffer.from([0x0D, 1, 0x0A, AVR_PROTOCOL_ESCAPE, 2]);
+        const escaped = escapeTestFrame(frame);
+
+        expect(escaped.indexOf(0x0A)).toBe(-1);
+        expect(escaped.indexOf(0x0D)).toBe(-1);
+        expect(unescapeAvrStatusFrame(escaped)).toStrictEqual(frame);
+    });
+
+    it('should reject text status with wrong sections', () => {
+        expect(decodeAvrStatusText(TEXT_STATUS_SECTIONS.slice(1))).toBeUndefined();
+        expect(decodeAvrStatusText(["X", ...TEXT_STATUS_SECTIONS.slice(1)])).toBeUndefined();
+        expect(decodeAvrStatusText([TEXT_STATUS_SECTIONS[0] + ",1", ...TEXT_STATUS_SECTIONS.slice(1)])).toBeUndefined();
+    });
+});
@@ -0,0 +1,41 @@
+import { addAvrCrc } from "./AvrLineParser";
+import { AVR_PROTOCOL_ESCAPE, avrProtocolVersion } from "./protocol";
+
+// Lines the same way the firmware writes them, for specs of the protocol and its parsers
+
+// Sections A..J of a text status, binary frame with the same values is built in protocol.spec.ts
+export const TEXT_STATUS_SECTIONS = [
+    "A12d,,1,e,fffffffb,,fff0,d2f0,,,1,", "B,,190,1,", "C,,1a0,2,", "D,,,,,,,,", "E,,,,,,,,", "F,,,,", "G,,,,", "H,,,", "I,,,,", "J,,,,,"
+];
+
+export function calcTestCrc(bytes: ArrayLike<number>): number {
+    let crc = 0;
+    for (let i = 0; i < bytes.length; i++) {
+        crc = addAvrCrc(crc, bytes[i]);
+    }
+    return crc;
+}
+
+// Bytes that would break lines are sent as escape, byte ^ 0x20
+export function escapeTestFrame(frame: ArrayLike<number>): Buffer {
+    const bytes: number[] = [];
+    for (let i = 0; i < frame.length; i++) {
+        const b = frame[i];
+        if (b === 0x0D || b === 0x0A || b === AVR_PROTOCOL_ESCAPE) {
+            bytes.push(AVR_PROTOCOL_ESCAPE, b ^ 0x20);
+        } else {
+            bytes.push(b);
+        }
+    }
+    return Buffer.from(bytes);
+}
+
+export function textStatusLine(sections: string[], version = avrProtocolVersion): string {
+    const subject = " " + sections.join(" ") + " " + version.toString(16) + " ";
+    const crc = calcTestCrc(Buffer.from(subject, "latin1"));
+    return subject + (crc ? crc.toString(16) : "") + "\r\n";
+}
+
+export function binaryStatusLine(frame: Buffer): Buffer {
+    return Buffer.concat([Buffer.from([0x23]), escapeTestFrame([...frame, calcTestCrc(frame)]), Buffer.from([0x0D, 0x0A])]);
+}
@@ -1,72 +1,369 @@
-// This file is auto-generated by src/avr/maintain-protocol script! DON'T EDIT!
+// This file is auto-generated by src/avr/maintain-protocol from src/avr/protocol.json! DON'T EDIT!
 
-export const avrProtocolVersion = 0xa8;
+export const avrProtocolVersion = 0xe5bf;
 
+// Bytes \r, \n and this one are sent as AVR_PROTOCOL_ESCAPE, byte ^ 0x20 in binary status
+export const AVR_PROTOCOL_ESCAPE = 0x7d;
+
+// Version and fields of binary status, without CRC
+export const AVR_STATUS_FRAME_SIZE = 116;
+
+export type AvrCommandCode = 'F' | 'G' | 'L' | 'D' | 'A' | 'B' | 'C' | 'U' | 'V' | 'R' | 'T' | 'P' | 'E' | 'S';
+
+export enum AvrStatusFormat {
+    Text = 0,
+    Binary = 1,
+}
+
+export type AvrTraceArgType = 'u8' | 'u16' | 'u32' | 'i16' | 'i32';
+
+export interface AvrTracepoint {
+    readonly name: string;
+    readonly minIntervalSeconds: number;
+    readonly args: ReadonlyArray<{ readonly name: string, readonly type: AvrTraceArgType }>;
+}
+
+// Tracepoint with id N is AVR_TRACEPOINTS[N - 1] (see AvrTrace.ts)
+export const AVR_TRACEPOINTS: ReadonlyArray<AvrTracepoint> = [
+    { name: "ClockCorrected", minIntervalSeconds: 0, args: [{ name: "driftDeciseconds", type: 'i32' }, { name: "trimPpmX8", type: 'i16' }] },
+    { name: "UploadRejected", minIntervalSeconds: 1, args: [{ name: "target", type: 'u8' }, { name: "size", type: 'u8' }] },
+    { name: "PhBatchDropped", minIntervalSeconds: 5, args: [{ name: "tick", type: 'u32' }] },
+    { name: "PhSafetyLockout", minIntervalSeconds: 0, args: [{ name: "lockout", type: 'u8' }, { name: "milliPh", type: 'u16' }] },
+    { name: "Co2nnPrediction", minIntervalSeconds: 60, args: [{ name: "milliPh", type: 'u16' }, { name: "onClose", type: 'u8' }, { name: "cycles", type: 'u32' }] },
+];
+
+// Values are scaled into units
 export interface AvrData {
-    "u32 uptime_deciseconds": number,
-    "u8 debug_overflow_count": number,
-    "u8 usart0_rx_overflow_count": number,
-    "u32 main_loop_iterations_in_last_decisecond": number,
-    "u32 ((u32)last_drift_of_clock_deciseconds_since_midnight)": number,
-    "u32 clock_corrections_since_protection_stat_reset": number,
-    "u32 clock_deciseconds_since_midnight": number,
-    "u8 ds18b20_aqua.get_crc_errors()": number,
-    "u8 ds18b20_aqua.get_disconnects()": number,
-    "u16 ds18b20_aqua.get_temperatureX16()": number,
-    "u8 ds18b20_aqua.get_update_id()": number,
-    "u8 ds18b20_aqua.get_updated_deciseconds_ago()": number,
-    "u8 ds18b20_case.get_crc_errors()": number,
-    "u8 ds18b20_case.get_disconnects()": number,
-    "u16 ds18b20_case.get_temperatureX16()": number,
-    "u8 ds18b20_case.get_update_id()": number,
-    "u8 ds18b20_case.get_updated_deciseconds_ago()": number,
-    "u8 co2_switch.is_set() ? 1 : 0": number,
-    "u8 co2_calculated_day ? 1 : 0": number,
-    "u8 co2_force_off.is_set() ? 1 : 0": number,
-    "u8 required_co2_switch_state.is_set() ? 1 : 0": number,
-    "u32 co2_deciseconds_until_can_turn_on": number,
-    "u8 day_light_switch.is_set() ? 1 : 0": number,
-    "u8 night_light_switch.is_set() ? 1 : 0": number,
-    "u8 day_light_forced.is_set() ? 1 : 0": number,
-    "u8 night_light_forced.is_set() ? 1 : 0": number,
-    "u8 light_forces_since_protection_stat_reset": number,
-    "u8 alternative_day_enabled": number,
-    "u32 __ph_adc_accum": number,
-    "u16 __ph_adc_accum_samples": number,
-    "u16 __ph_adc_bad_samples": number,
+    // A1: u32 uptime_deciseconds, s
+    readonly uptimeSeconds: number;
+    // A2: u8 trace_drop_count
+    readonly traceDrops: number;
+    // A3: u8 usart0_rx_overflow_count
+    readonly usbRxOverflows: number;
+    // A4: u32 main_loop_iterations_in_last_decisecond
+    readonly mainLoopIterationsInLastDecisecond: number;
+    // A5: i32 last_drift_of_clock_deciseconds_since_midnight, s
+    readonly clockDriftSeconds: number;
+    // A6: u32 clock_corrections_since_protection_stat_reset
+    readonly clockCorrectionsSinceProtectionStatReset: number;
+    // A7: i16 clock_trim_ppm_x8, ppm
+    readonly clockTrimPpm: number;
+    // A8: u32 clock_deciseconds_since_midnight, s
+    readonly clockSecondsSinceMidnight: number;
+    // A9: u8 upload_errors
+    readonly uploadErrors: number;
+    // A10: u8 mcusr_at_startup
+    readonly resetFlags: number;
+    // A11: u8 warm_restarted
+    readonly warmRestarted: number;
+    // A12: u8 events_next_seq
+    readonly eventsNextSeq: number;
+    // B1: u8 ds18b20_aqua.get_crc_errors()
+    readonly aquaTemperatureCrcErrors: number;
+    // B2: u8 ds18b20_aqua.get_disconnects()
+    readonly aquaTemperatureDisconnects: number;
+    // B3: u16 ds18b20_aqua.get_temperatureX16(), C
+    readonly aquaTemperature: number;
+    // B4: u8 ds18b20_aqua.get_update_id()
+    readonly aquaTemperatureUpdateId: number;
+    // B5: u8 ds18b20_aqua.get_updated_deciseconds_ago(), s
+    readonly aquaTemperatureUpdatedSecondsAgo: number;
+    // C1: u8 ds18b20_case.get_crc_errors()
+    readonly caseTemperatureCrcErrors: number;
+    // C2: u8 ds18b20_case.get_disconnects()
+    readonly caseTemperatureDisconnects: number;
+    // C3: u16 ds18b20_case.get_temperatureX16(), C
+    readonly caseTemperature: number;
+    // C4: u8 ds18b20_case.get_update_id()
+    readonly caseTemperatureUpdateId: number;
+    // C5: u8 ds18b20_case.get_updated_deciseconds_ago(), s
+    readonly caseTemperatureUpdatedSecondsAgo: number;
+    // D1: u8 co2_switch.is_set() ? 1 : 0
+    readonly co2ValveOpen: number;
+    // D2: u8 co2_calculated_day ? 1 : 0
+    readonly co2Day: number;
+    // D3: u8 is_timer_armed(Co2ForceOffTimer) ? 1 : 0
+    readonly co2ForcedOff: number;
+    // D4: u8 is_timer_armed(RequiredCo2SwitchStateTimer) ? 1 : 0
+    readonly co2IsRequired: number;
+    // D5: u32 co2_deciseconds_until_can_turn_on, s
+    readonly co2CooldownSeconds: number;
+    // D6: u8 capture_state
+    readonly captureState: number;
+    // D7: u8 capture_id
+    readonly captureId: number;
+    // D8: u8 capture_co2_state
+    readonly captureCo2ValveOpen: number;
+    // D9: u32 capture_clock_deciseconds_since_midnight, s
+    readonly captureClockSecondsSinceMidnight: number;
+    // E1: u8 day_light_switch.is_set() ? 1 : 0
+    readonly dayLightOn: number;
+    // E2: u8 night_light_switch.is_set() ? 1 : 0
+    readonly nightLightOn: number;
+    // E3: u8 is_timer_armed(DayLightForcedTimer) ? 1 : 0
+    readonly dayLightForced: number;
+    // E4: u8 is_timer_armed(NightLightForcedTimer) ? 1 : 0
+    readonly nightLightForced: number;
+    // E5: u8 light_forces_since_protection_stat_reset
+    readonly lightForcesSinceProtectionStatReset: number;
+    // E6: u8 schedule_profile
+    readonly scheduleProfile: number;
+    // E7: u8 schedule_crc
+    readonly scheduleCrc: number;
+    // E8: u8 dimmer_levels[DayLightDimmer]
+    readonly dayLightLevel: number;
+    // E9: u8 dimmer_levels[NightLightDimmer]
+    readonly nightLightLevel: number;
+    // F1: u32 __ph_adc_batch.tick
+    readonly phBatchTick: number;
+    // F2: u32 __ph_adc_batch.accum
+    readonly phBatchAccum: number;
+    // F3: u16 __ph_adc_batch.samples
+    readonly phBatchSamples: number;
+    // F4: u16 __ph_adc_batch.bad_samples
+    readonly phBatchBadSamples: number;
+    // F5: u8 ph_adc_batch_fifo_overflow_count
+    readonly phBatchOverflows: number;
+    // G1: u32 ph_q16, PH
+    readonly ph: number;
+    // G2: u16 ph_compensation_temperatureX16, C
+    readonly phCompensationTemperature: number;
+    // G3: u8 ph_calibration_valid
+    readonly phCalibrationValid: number;
+    // G4: u8 ph_calibration_crc
+    readonly phCalibrationCrc: number;
+    // G5: u8 ph_safety_co2_lockout
+    readonly phSafetyCo2Lockout: number;
+    // H1: u32 ph_short_window_q16, PH
+    readonly ph60s: number;
+    // H2: u16 ph_window_short_seconds, s
+    readonly ph60sSeconds: number;
+    // H3: u32 ph_long_window_q16, PH
+    readonly ph600s: number;
+    // H4: u16 ph_window_long_seconds, s
+    readonly ph600sSeconds: number;
+    // I1: u8 co2_curve_mode
+    readonly co2CurveMode: number;
+    // I2: u8 co2_curve_crc
+    readonly co2CurveCrc: number;
+    // I3: u8 co2_curve_in_control
+    readonly co2CurveInControl: number;
+    // I4: u8 co2_curve_required_state
+    readonly co2CurveRequiredState: number;
+    // I5: u16 co2_curve_min_milli_ph, PH
+    readonly co2CurveMinPh: number;
+    // J1: u8 co2nn_prediction_id
+    readonly co2nnPredictionId: number;
+    // J2: u16 co2nn_prediction_milli_ph, PH
+    readonly co2nnPredictionMinPh: number;
+    // J3: u8 co2nn_prediction_on_close
+    readonly co2nnPredictionOnClose: number;
+    // J4: u32 co2nn_prediction_cycles
+    readonly co2nnPredictionCycles: number;
+    // J5: u8 co2nn_config_valid
+    readonly co2nnConfigValid: number;
+    // J6: u8 co2nn_config_crc
+    readonly co2nnConfigCrc: number;
 }
 
-export function asAvrData(vals: {[id: string]: number}): AvrData { return {
-    "u32 uptime_deciseconds": vals["A1"],
-    "u8 debug_overflow_count": vals["A2"],
-    "u8 usart0_rx_overflow_count": vals["A3"],
-    "u32 main_loop_iterations_in_last_decisecond": vals["A4"],
-    "u32 ((u32)last_drift_of_clock_deciseconds_since_midnight)": vals["A5"],
-    "u32 clock_corrections_since_protection_stat_reset": vals["A6"],
-    "u32 clock_deciseconds_since_midnight": vals["A7"],
-    "u8 ds18b20_aqua.get_crc_errors()": vals["B1"],
-    "u8 ds18b20_aqua.get_disconnects()": vals["B2"],
-    "u16 ds18b20_aqua.get_temperatureX16()": vals["B3"],
-    "u8 ds18b20_aqua.get_update_id()": vals["B4"],
-    "u8 ds18b20_aqua.get_updated_deciseconds_ago()": vals["B5"],
-    "u8 ds18b20_case.get_crc_errors()": vals["C1"],
-    "u8 ds18b20_case.get_disconnects()": vals["C2"],
-    "u16 ds18b20_case.get_temperatureX16()": vals["C3"],
-    "u8 ds18b20_case.get_update_id()": vals["C4"],
-    "u8 ds18b20_case.get_updated_deciseconds_ago()": vals["C5"],
-    "u8 co2_switch.is_set() ? 1 : 0": vals["D1"],
-    "u8 co2_calculated_day ? 1 : 0": vals["D2"],
-    "u8 co2_force_off.is_set() ? 1 : 0": vals["D3"],
-    "u8 required_co2_switch_state.is_set() ? 1 : 0": vals["D4"],
-    "u32 co2_deciseconds_until_can_turn_on": vals["D5"],
-    "u8 day_light_switch.is_set() ? 1 : 0": vals["E1"],
-    "u8 night_light_switch.is_set() ? 1 : 0": vals["E2"],
-    "u8 day_light_forced.is_set() ? 1 : 0": vals["E3"],
-    "u8 night_light_forced.is_set() ? 1 : 0": vals["E4"],
-    "u8 light_forces_since_protection_stat_reset": vals["E5"],
-    "u8 alternative_day_enabled": vals["E6"],
-    "u32 __ph_adc_accum": vals["F1"],
-    "u16 __ph_adc_accum_samples": vals["F2"],
-    "u16 __ph_adc_bad_samples": vals["F3"],
-};}
+const hex = (s: string): number => s ? parseInt(s, 16) : 0;
+const i16 = (v: number): number => v > 0x7FFF ? v - 0x10000 : v;
+const i32 = (v: number): number => v > 0x7FFFFFFF ? v - 0x100000000 : v;
+
+// Sections of text status line (without leading space, version and CRC), e.g. ['A1,,2', 'B', ...]
+export function decodeAvrStatusText(sections: ReadonlyArray<string>): AvrData | undefined {
+    if (sections.length !== 10) {
+        return undefined;
+    }
 
+    const a = sections[0].substr(1).split(",");
+    const b = sections[1].substr(1).split(",");
+    const c = sections[2].substr(1).split(",");
+    const d = sections[3].substr(1).split(",");
+    const e = sections[4].substr(1).split(",");
+    const f = sections[5].substr(1).split(",");
+    const g = sections[6].substr(1).split(",");
+    const h = sections[7].substr(1).split(",");
+    const i = sections[8].substr(1).split(",");
+    const j = sections[9].substr(1).split(",");
+
+    if (sections[0][0] !== 'A' || a.length !== 12
+        || sections[1][0] !== 'B' || b.length !== 5
+        || sections[2][0] !== 'C' || c.length !== 5
+        || sections[3][0] !== 'D' || d.length !== 9
+        || sections[4][0] !== 'E' || e.length !== 9
+        || sections[5][0] !== 'F' || f.length !== 5
+        || sections[6][0] !== 'G' || g.length !== 5
+        || sections[7][0] !== 'H' || h.length !== 4
+        || sections[8][0] !== 'I' || i.length !== 5
+        || sections[9][0] !== 'J' || j.length !== 6) {
+        return undefined;
+    }
+
+    return {
+        uptimeSeconds: hex(a[0]) / 10,
+        traceDrops: hex(a[1]),
+        usbRxOverflows: hex(a[2]),
+        mainLoopIterationsInLastDecisecond: hex(a[3]),
+        clockDriftSeconds: i32(hex(a[4])) / 10,
+        clockCorrectionsSinceProtectionStatReset: hex(a[5]),
+        clockTrimPpm: i16(hex(a[6])) / 8,
+        clockSecondsSinceMidnight: hex(a[7]) / 10,
+        uploadErrors: hex(a[8]),
+        resetFlags: hex(a[9]),
+        warmRestarted: hex(a[10]),
+        eventsNextSeq: hex(a[11]),
+        aquaTemperatureCrcErrors: hex(b[0]),
+        aquaTemperatureDisconnects: hex(b[1]),
+        aquaTemperature: hex(b[2]) / 16,
+        aquaTemperatureUpdateId: hex(b[3]),
+        aquaTemperatureUpdatedSecondsAgo: hex(b[4]) / 10,
+        caseTemperatureCrcErrors: hex(c[0]),
+        caseTemperatureDisconnects: hex(c[1]),
+        caseTemperature: hex(c[2]) / 16,
+        caseTemperatureUpdateId: hex(c[3]),
+        caseTemperatureUpdatedSecondsAgo: hex(c[4]) / 10,
+        co2ValveOpen: hex(d[0]),
+        co2Day: hex(d[1]),
+        co2ForcedOff: hex(d[2]),
+        co2IsRequired: hex(d[3]),
+        co2CooldownSeconds: hex(d[4]) / 10,
+        captureState: hex(d[5]),
+        captureId: hex(d[6]),
+        captureCo2ValveOpen: hex(d[7]),
+        captureClockSecondsSinceMidnight: hex(d[8]) / 10,
+        dayLightOn: hex(e[0]),
+        nightLightOn: hex(e[1]),
+        dayLightForced: hex(e[2]),
+        nightLightForced: hex(e[3]),
+        lightForcesSinceProtectionStatReset: hex(e[4]),
+        scheduleProfile: hex(e[5]),
+        scheduleCrc: hex(e[6]),
+        dayLightLevel: hex(e[7]) / 255,
+        nightLightLevel: hex(e[8]) / 255,
+        phBatchTick: hex(f[0]),
+        phBatchAccum: hex(f[1]),
+        phBatchSamples: hex(f[2]),
+        phBatchBadSamples: hex(f[3]),
+        phBatchOverflows: hex(f[4]),
+        ph: hex(g[0]) / 65536,
+        phCompensationTemperature: hex(g[1]) / 16,
+        phCalibrationValid: hex(g[2]),
+        phCalibrationCrc: hex(g[3]),
+        phSafetyCo2Lockout: hex(g[4]),
+        ph60s: hex(h[0]) / 65536,
+        ph60sSeconds: hex(h[1]),
+        ph600s: hex(h[2]) / 65536,
+        ph600sSeconds: hex(h[3]),
+        co2CurveMode: hex(i[0]),
+        co2CurveCrc: hex(i[1]),
+        co2CurveInControl: hex(i[2]),
+        co2CurveRequiredState: hex(i[3]),
+        co2CurveMinPh: hex(i[4]) / 1000,
+        co2nnPredictionId: hex(j[0]),
+        co2nnPredictionMinPh: hex(j[1]) / 1000,
+        co2nnPredictionOnClose: hex(j[2]),
+        co2nnPredictionCycles: hex(j[3]),
+        co2nnConfigValid: hex(j[4]),
+        co2nnConfigCrc: hex(j[5]),
+    };
+}
+
+// Unescaped binary status without '#' (version, fields, CRC), see decodeAvrStatusFrame
+export function unescapeAvrStatusFrame(escaped: Buffer): Buffer {
+    if (escaped.indexOf(AVR_PROTOCOL_ESCAPE) < 0) {
+        return escaped;
+    }
+
+    const frame = Buffer.alloc(escaped.length);
+    let length = 0;
+    for (let i = 0; i < escaped.length; i++) {
+        frame[length++] = escaped[i] === AVR_PROTOCOL_ESCAPE ? escaped[++i] ^ 0x20 : escaped[i];
+    }
+    return frame.slice(0, length);
+}
+
+// Offsets and sizes of fields of text status sections in binary status frame (see AvrLineParser)
+export const AVR_STATUS_LAYOUT: ReadonlyArray<{ readonly id: string, readonly offsets: ReadonlyArray<number>, readonly sizes: ReadonlyArray<number> }> = [
+    { id: 'A', offsets: [2, 6, 7, 8, 12, 16, 20, 22, 26, 27, 28, 29], sizes: [4, 1, 1, 4, 4, 4, 2, 4, 1, 1, 1, 1] },
+    { id: 'B', offsets: [30, 31, 32, 34, 35], sizes: [1, 1, 2, 1, 1] },
+    { id: 'C', offsets: [36, 37, 38, 40, 41], sizes: [1, 1, 2, 1, 1] },
+    { id: 'D', offsets: [42, 43, 44, 45, 46, 50, 51, 52, 53], sizes: [1, 1, 1, 1, 4, 1, 1, 1, 4] },
+    { id: 'E', offsets: [57, 58, 59, 60, 61, 62, 63, 64, 65], sizes: [1, 1, 1, 1, 1, 1, 1, 1, 1] },
+    { id: 'F', offsets: [66, 70, 74, 76, 78], sizes: [4, 4, 2, 2, 1] },
+    { id: 'G', offsets: [79, 83, 85, 86, 87], sizes: [4, 2, 1, 1, 1] },
+    { id: 'H', offsets: [88, 92, 94, 98], sizes: [4, 2, 4, 2] },
+    { id: 'I', offsets: [100, 101, 102, 103, 104], sizes: [1, 1, 1, 1, 2] },
+    { id: 'J', offsets: [106, 107, 109, 110, 114, 115], sizes: [1, 2, 1, 4, 1, 1] },
+];
+
+// Fields are read at their offsets, frame must be at least AVR_STATUS_FRAME_SIZE bytes
+export function decodeAvrStatusFrame(frame: Buffer): AvrData {
+    return {
+        uptimeSeconds: frame.readUInt32LE(2) / 10,
+        traceDrops: frame.readUInt8(6),
+        usbRxOverflows: frame.readUInt8(7),
+        mainLoopIterationsInLastDecisecond: frame.readUInt32LE(8),
+        clockDriftSeconds: frame.readInt32LE(12) / 10,
+        clockCorrectionsSinceProtectionStatReset: frame.readUInt32LE(16),
+        clockTrimPpm: frame.readInt16LE(20) / 8,
+        clockSecondsSinceMidnight: frame.readUInt32LE(22) / 10,
+        uploadErrors: frame.readUInt8(26),
+        resetFlags: frame.readUInt8(27),
+        warmRestarted: frame.readUInt8(28),
+        eventsNextSeq: frame.readUInt8(29),
+        aquaTemperatureCrcErrors: frame.readUInt8(30),
+        aquaTemperatureDisconnects: frame.readUInt8(31),
+        aquaTemperature: frame.readUInt16LE(32) / 16,
+        aquaTemperatureUpdateId: frame.readUInt8(34),
+        aquaTemperatureUpdatedSecondsAgo: frame.readUInt8(35) / 10,
+        caseTemperatureCrcErrors: frame.readUInt8(36),
+        caseTemperatureDisconnects: frame.readUInt8(37),
+        caseTemperature: frame.readUInt16LE(38) / 16,
+        caseTemperatureUpdateId: frame.readUInt8(40),
+        caseTemperatureUpdatedSecondsAgo: frame.readUInt8(41) / 10,
+        co2ValveOpen: frame.readUInt8(42),
+        co2Day: frame.readUInt8(43),
+        co2ForcedOff: frame.readUInt8(44),
+        co2IsRequired: frame.readUInt8(45),
+        co2CooldownSeconds: frame.readUInt32LE(46) / 10,
+        captureState: frame.readUInt8(50),
+        captureId: frame.readUInt8(51),
+        captureCo2ValveOpen: frame.readUInt8(52),
+        captureClockSecondsSinceMidnight: frame.readUInt32LE(53) / 10,
+        dayLightOn: frame.readUInt8(57),
+        nightLightOn: frame.readUInt8(58),
+        dayLightForced: frame.readUInt8(59),
+        nightLightForced: frame.readUInt8(60),
+        lightForcesSinceProtectionStatReset: frame.readUInt8(61),
+        scheduleProfile: frame.readUInt8(62),
+        scheduleCrc: frame.readUInt8(63),
+        dayLightLevel: frame.readUInt8(64) / 255,
+        nightLightLevel: frame.readUInt8(65) / 255,
+        phBatchTick: frame.readUInt32LE(66),
+        phBatchAccum: frame.readUInt32LE(70),
+        phBatchSamples: frame.readUInt16LE(74),
+        phBatchBadSamples: frame.readUInt16LE(76),
+        phBatchOverflows: frame.readUInt8(78),
+        ph: frame.readUInt32LE(79) / 65536,
+        phCompensationTemperature: frame.readUInt16LE(83) / 16,
+        phCalibrationValid: frame.readUInt8(85),
+        phCalibrationCrc: frame.readUInt8(86),
+        phSafetyCo2Lockout: frame.readUInt8(87),
+        ph60s: frame.readUInt32LE(88) / 65536,
+        ph60sSeconds: frame.readUInt16LE(92),
+        ph600s: frame.readUInt32LE(94) / 65536,
+        ph600sSeconds: frame.readUInt16LE(98),
+        co2CurveMode: frame.readUInt8(100),
+        co2CurveCrc: frame.readUInt8(101),
+        co2CurveInControl: frame.readUInt8(102),
+        co2CurveRequiredState: frame.readUInt8(103),
+        co2CurveMinPh: frame.readUInt16LE(104) / 1000,
+        co2nnPredictionId: frame.readUInt8(106),
+        co2nnPredictionMinPh: frame.readUInt16LE(107) / 1000,
+        co2nnPredictionOnClose: frame.readUInt8(109),
+        co2nnPredictionCycles: frame.readUInt32LE(110),
+        co2nnConfigValid: frame.readUInt8(114),
+        co2nnConfigCrc: frame.readUInt8(115),
+    };
+}
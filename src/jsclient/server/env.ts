@@ -8,6 +8,7 @@ export interface Env {
     version?: string;
     nextionPort?: string;
     avrPort?: string;
+    avrRecordFile?: string;
     instanceName?: string; 
 };
 
@@ -18,5 +19,6 @@ export const realEnv: Env = {
     version: process.env.AKUA_VERSION,
     nextionPort: process.env.AKUA_NEXTION_PORT,
     avrPort: process.env.AKUA_PORT,
+    avrRecordFile: process.env.AKUA_AVR_RECORD,
     instanceName: process.env.AKUA_INSTANCE
 };
\ No newline at end of file
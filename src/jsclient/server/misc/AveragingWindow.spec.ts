@@ -3,6 +3,7 @@ import "reflect-metadata";
 import expect from "expect";
 import TimeService from "server/service/TimeService";
 import { AveragingWindow } from "./AveragingWindow";
+import { getTimestampSecondsBefore } from "./get-timestamp-seconds-before";
 
 class TimeServiceMockImpl implements TimeService {
     now: number = 0;
@@ -331,4 +332,24 @@ describe('AveragingWindow', () => {
             expect(avg.get()).toStrictEqual(null);
         });
     }
-});
\ No newline at end of file
+
+    it('should expire samples by the time they were taken', () => {
+        const timeService = new TimeServiceMockImpl();
+        const avg = new AveragingWindow({
+            windowSpanSeconds: 1,
+            sampleFrequency: 2,
+            timeService
+        });
+
+        // Both samples come now, but the first one was taken 0.8 seconds ago
+        timeService.now = 10;
+        avg.add(0, getTimestampSecondsBefore({ now: timeService.nowTimestamp(), seconds: 0.8 }));
+        avg.add(10);
+        expect(avg.getCount()).toStrictEqual(2);
+        expect(avg.get()).toStrictEqual(5);
+
+        timeService.now = 10.4;
+        expect(avg.getCount()).toStrictEqual(1);
+        expect(avg.get()).toStrictEqual(10);
+    });
+});
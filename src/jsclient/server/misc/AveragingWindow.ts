@@ -75,7 +75,8 @@ export class AveragingWindow {
         return null;
     }
 
-    add(v: number): void {
+    // Sample is taken now unless its time is given (it must not be older than the samples added before)
+    add(v: number, t: Timestamp = this._params.timeService.nowTimestamp()): void {
         this._lastFilteringResult = null;
 
         if (this._count === this._buf.length) {
@@ -95,7 +96,7 @@ export class AveragingWindow {
             this._buf = newBuf;
         }
 
-        this._buf[this._emptyIdx] = { t: this._params.timeService.nowTimestamp(), v };
+        this._buf[this._emptyIdx] = { t, v };
         this._emptyIdx = this._incBufIdx(this._emptyIdx);
         this._count += 1;
     }
@@ -0,0 +1,10 @@
+import type { Timestamp } from "./Timestamp";
+
+/**
+ * Returns timestamp that is "seconds" before "now".
+ */
+export function getTimestampSecondsBefore({now, seconds}: {now: Timestamp, seconds: number}): Timestamp {
+    const t = now[0] + now[1] / 1e9 - seconds;
+    const secs = Math.floor(t);
+    return [secs, Math.round((t - secs) * 1e9)];
+}
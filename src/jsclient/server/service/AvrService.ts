@@ -7,7 +7,7 @@ export interface AvrServiceState {
     readonly serialPortIsOpen: 0 | 1;
     readonly protocolVersionMismatch: 0 | 1;
     readonly protocolCrcErrors: number;
-    readonly protocolDebugMessages: number;
+    readonly protocolTraceRecords: number;
     readonly incomingMessages: number;
     readonly outgoingMessages: number;
     readonly lastAvrState?: AvrState;
@@ -20,12 +20,110 @@ export interface AvrLightState {
     readonly nightLightForced: boolean;
     readonly lightForcesSinceProtectionStatReset: number;
     readonly alternativeDayEnabled: boolean;
+
+    /**
+     * Selected schedule profile (0 - normal day, 1 - alternative day, ...) and CRC of the whole schedule table.
+     */
+    readonly scheduleProfile: number;
+    readonly scheduleCrc: number;
+
+    /**
+     * Brightness of PWM dimmers (0..1), they ramp up / down at the edges of light intervals of the schedule.
+     */
+    readonly dayLightLevel: number;
+    readonly nightLightLevel: number;
 }
 
 export interface AvrPhState {
+    /**
+     * Uptime (in deciseconds) when AVR closed the batch of ADC samples. Batches are closed at fixed
+     * rate, the same batch is repeated in the next status if there is no new one yet.
+     */
+    readonly batchTick: number;
+
+    /**
+     * How long ago (seconds) the batch was closed when the status was received. It's batchTick mapped
+     * to host time by time sync, or estimated from uptime of the status if there is no time sync yet.
+     */
+    readonly batchAgeSeconds: number;
+
+    /**
+     * Number of batches AVR dropped because they were not sent in time (saturates at 255).
+     */
+    readonly batchOverflows: number;
+
     readonly voltage: number;
     readonly voltageSamples: number;
     readonly badSamples: number;
+
+    /**
+     * Temperature compensated PH as calculated by AVR. Null if AVR has no calibration or no samples.
+     */
+    readonly value: number | null;
+
+    /**
+     * PH averaged by AVR over the last 60 and 600 seconds. Null if less than half of the window is valid.
+     * AVR keeps them across host restarts, so they are available right away.
+     */
+    readonly value60s: number | null;
+    readonly value60sSeconds: number;
+    readonly value600s: number | null;
+    readonly value600sSeconds: number;
+
+    /**
+     * Temperature used by AVR to compensate PH.
+     */
+    readonly compensationTemperature: number;
+
+    /**
+     * CRC of the calibration AVR uses or null if AVR has no calibration.
+     */
+    readonly calibrationCrc: number | null;
+
+    /**
+     * True if AVR doesn't allow CO2 because PH is too low.
+     */
+    readonly safetyCo2Lockout: boolean;
+}
+
+/**
+ * On-MCU CO2 controller that uses min-PH curve uploaded by us.
+ */
+export interface AvrCo2CurveState {
+    readonly mode: Co2CurveMode;
+    readonly crc: number;
+
+    /**
+     * True if AVR decides instead of us (continuous mode or we have stopped sending CO2 commands).
+     */
+    readonly inControl: boolean;
+    readonly co2IsRequired: boolean;
+
+    /**
+     * Min PH of the curve for the current minute or null if CO2 is not allowed by the curve.
+     */
+    readonly minPh: number | null;
+}
+
+/**
+ * The last min-PH prediction made by the quantized network on AVR.
+ */
+export interface AvrCo2nnPrediction {
+    /**
+     * Incremented with every prediction.
+     */
+    readonly id: number;
+    readonly minPh: number;
+
+    /**
+     * True if prediction was made when CO2 valve was closed, otherwise it's "what if it's closed now".
+     */
+    readonly onClose: boolean;
+
+    /**
+     * CPU cycles used by the prediction (measured with Timer1, so it includes interrupts).
+     */
+    readonly cycles: number;
 }
 
 export interface AvrTemperatureSensorState {
@@ -36,25 +134,148 @@ export interface AvrTemperatureSensorState {
     readonly updatedSecondsAgo: number;
 }
 
+// Must be the same enum as the enum in firmware with the same name
+export enum CaptureState {
+    CaptureDisarmed = 0,
+    CaptureArmed = 1,
+    CaptureTriggered = 2,
+    CaptureReady = 3
+};
+
+/**
+ * Decimated PH samples recorded by AVR around switching of CO2 valve.
+ */
+export interface AvrCo2ValveCapture {
+    /**
+     * When the valve was switched (unix time in seconds as estimated from AVR clock).
+     */
+    readonly switchTime: number;
+
+    /**
+     * New state of the valve.
+     */
+    readonly co2ValveOpen: boolean;
+
+    readonly samplePeriodSeconds: number;
+
+    /**
+     * Number of samples recorded before the switching.
+     */
+    readonly preTriggerSamples: number;
+
+    /**
+     * Voltages or null for samples affected by noise.
+     */
+    readonly voltages: (number | null)[];
+}
+
 export interface AvrState {
     readonly mainLoopIterationsInLastDecisecond: number;
     readonly uptimeSeconds: number;
     readonly clockDriftSeconds: number;
     readonly clockCorrectionsSinceProtectionStatReset: number;
+    readonly clockTrimPpm: number;
     readonly clockSecondsSinceMidnight: number;
-    readonly debugOverflows: number;
+    /**
+     * Trace records AVR dropped (rate limit or full trace buffer), saturated at 255.
+     */
+    readonly traceDrops: number;
     readonly usbRxOverflows: number;
+    readonly uploadErrors: number;
+    /**
+     * MCUSR as it was when AVR started (i.e. cause of the last reset).
+     */
+    readonly resetFlags: number;
+    /**
+     * Whether AVR resumed its state after the last reset.
+     */
+    readonly warmRestarted: boolean;
+    /**
+     * Sequence number (0..255) of the next event AVR logs, see AvrEvent.
+     */
+    readonly eventsNextSeq: number;
     readonly aquariumTemperatureSensor: AvrTemperatureSensorState;
     readonly caseTemperatureSensor: AvrTemperatureSensorState;
     readonly light: AvrLightState;
     readonly ph: AvrPhState;
+    readonly co2Curve: AvrCo2CurveState;
+    readonly co2nnPrediction: AvrCo2nnPrediction | null;
+    /**
+     * CRC of CO2 NN config AVR uses, null if there is none (AVR doesn't predict then).
+     */
+    readonly co2nnConfigCrc: number | null;
     readonly co2ValveOpen: boolean;
     readonly co2day: boolean;
     readonly co2forcedOff: boolean;
     readonly co2IsRequired: boolean;
     readonly co2CooldownSeconds: number;
+    readonly captureState: CaptureState;
+    readonly captureId: number;
+    readonly captureCo2ValveOpen: boolean;
+    readonly captureClockSecondsSinceMidnight: number;
+}
+
+export interface AvrTimeSync {
+    /**
+     * Round-trip time of time sync request (without serial transmission time).
+     */
+    readonly rttSeconds: number;
+
+    /**
+     * AVR clock minus our clock (as measured before we have sent a corrected clock).
+     */
+    readonly clockOffsetSeconds: number;
+}
+
+/**
+ * Event from AVR event log. Events are fetched incrementally, so they survive disconnects
+ * (as long as AVR doesn't log more events than it keeps) and have exact AVR time.
+ */
+export interface AvrEvent {
+    readonly seq: number;
+    readonly code: AvrEventCode;
+    readonly arg: number;
+
+    /**
+     * Unix time of the event. It's exact if timeSynced, otherwise it's based on time of reception.
+     */
+    readonly seconds: number;
+    readonly timeSynced: boolean;
 }
 
+/**
+ * Record of a firmware tracepoint (see tracepoints in protocol.json).
+ */
+export interface AvrTrace {
+    readonly name: string;
+    readonly args: { readonly [name: string]: number };
+
+    /**
+     * Records of the same tracepoint AVR dropped since the previous one.
+     */
+    readonly dropped: number;
+
+    /**
+     * Unix time of the record. It's exact to a decisecond if timeSynced, otherwise it's based on time of reception.
+     */
+    readonly seconds: number;
+    readonly timeSynced: boolean;
+}
+
+// Must be the same enum as EventCode in firmware
+export enum AvrEventCode {
+    EventStartup = 1,
+    EventDayLightSwitched = 2,
+    EventNightLightSwitched = 3,
+    EventCo2Switched = 4,
+    EventSafeOutputOff = 5,
+    EventLightForced = 6,
+    EventCo2ForcedOff = 7,
+    EventForceExpired = 8,
+    EventProtectionRejected = 9,
+    EventClockCorrected = 10
+};
+
 export enum LightForceMode {
     NotForced = 0,
     Day = 1,
@@ -66,10 +287,25 @@ export enum Co2ValveOpenState {
     Open = 1
 };
 
+// Must be the same enum as the enum in firmware with the same name
+export enum Co2CurveMode {
+    Co2CurveDisabled = 0,
+    Co2CurveFallback = 1,
+    Co2CurveContinuous = 2
+};
+
 @injectable()
 export default abstract class AvrService {
     readonly abstract avrState$: Observable<AvrState>;
 
+    readonly abstract co2ValveCapture$: Observable<AvrCo2ValveCapture>;
+
+    readonly abstract timeSync$: Observable<AvrTimeSync>;
+
+    readonly abstract avrEvent$: Observable<AvrEvent>;
+
+    readonly abstract avrTrace$: Observable<AvrTrace>;
+
     abstract getServiceState(): AvrServiceState;
 
     abstract forceLight(mode: LightForceMode): void;
@@ -20,6 +20,9 @@ export interface NextionConfig {
 
 export interface AvrConfig {
     readonly port: string;
+
+    // Everything received from AVR is appended to this file (see server/avr/AvrRecording.ts)
+    readonly recordFile?: string;
 }
 
 export interface ValueDisplayConfig {
@@ -44,6 +47,12 @@ export interface PhControllerConfig {
     readonly altDayEndHour: number,
     readonly dayStartPh: number,
     readonly dayEndPh: number,
+
+    /**
+     * Whether AVR controls CO2 by itself using the same min-PH curve: 'fallback' - only when
+     * we stop sending CO2 commands, 'continuous' - always (we only supervise it).
+     */
+    readonly avrCo2Controller: 'disabled' | 'fallback' | 'continuous',
 }
 
 export interface PhSensorCalibrationConfig {
@@ -66,6 +75,21 @@ export interface PhSensorCalibrationConfig {
      * Voltage for calibration PH defined in ph2.
      */
     readonly v2: number;
+
+    /**
+     * Temperature (celsius) of calibration solutions. Used by AVR to compensate PH for temperature.
+     */
+    readonly temperature: number;
+
+    /**
+     * AVR locks CO2 out when its own PH is below this for 10 seconds. Default is 6.6.
+     */
+    readonly safetyMinPh?: number;
+
+    /**
+     * AVR releases the lockout when PH is above safetyMinPh plus this for 10 seconds. Default is 0.1.
+     */
+    readonly safetyHysteresisPh?: number;
 }
 
 export interface PhClosingPredictionConfig {
@@ -73,11 +97,37 @@ export interface PhClosingPredictionConfig {
      * Defines how we split dataset into training and test (validation).
      */
     readonly trainDatasetPercentage: number;
+
+    /**
+     * Use predictions of the quantized network running on AVR (see src/co2nn/export_avr.py)
+     * instead of running the model in a worker thread.
+     */
+    readonly useAvr: boolean;
 }
 
 export interface DatabaseConfig {
     readonly baseDirectory: string;
     readonly phClosingStateDbFileName: string;
+    readonly co2ValveCaptureDbFileName: string;
+}
+
+export interface ScheduleTransitionConfig {
+    /**
+     * Minute of the day when the transition happens (outputs keep their state until the next transition).
+     */
+    readonly minute: number;
+    readonly dayLight: boolean;
+    readonly nightLight: boolean;
+    readonly co2: boolean;
+}
+
+export interface ScheduleConfig {
+    /**
+     * Profiles that are uploaded to AVR (up to 4 profiles with up to 8 transitions each, sorted by time).
+     * State before the first transition of the day is defined by the last transition.
+     * Profile 0 is the normal day, profile 1 is the alternative day.
+     */
+    readonly profiles: ReadonlyArray<ReadonlyArray<ScheduleTransitionConfig>>;
 }
 
 export interface AquaEnvConfig {
@@ -106,6 +156,7 @@ export interface Config {
     readonly phSensorCalibration: PhSensorCalibrationConfig;
     readonly co2Display: ValueDisplayConfig;
     readonly database: DatabaseConfig;
+    readonly schedule: ScheduleConfig;
     readonly phClosingPrediction: PhClosingPredictionConfig;
     readonly aquaEnv: AquaEnvConfig;
 }
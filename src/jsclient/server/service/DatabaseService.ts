@@ -1,5 +1,6 @@
 import { injectable } from "inversify";
 import { Co2ClosingState } from "./PhPrediction";
+import { AvrCo2ValveCapture } from "./AvrService";
 
 export enum Co2ClosingStateType {
     ANY = 0,
@@ -18,4 +19,6 @@ export default abstract class DatabaseService {
     abstract async findCo2ClosingTimes(type: Co2ClosingStateType): Promise<number[]>;
 
     abstract async countCo2ClosingStates(type: Co2ClosingStateType): Promise<number>;
+
+    abstract async insertCo2ValveCapture(capture: AvrCo2ValveCapture): Promise<void>;
 }
@@ -1,12 +1,15 @@
-import { injectable, postConstruct } from "inversify";
-import AvrService, { AvrServiceState, AvrState, AvrTemperatureSensorState, LightForceMode, AvrLightState, Co2ValveOpenState, AvrPhState } from "server/service/AvrService";
+import { injectable, postConstruct, optional, inject } from "inversify";
+import AvrService, { AvrServiceState, AvrState, AvrTemperatureSensorState, LightForceMode, AvrLightState, Co2ValveOpenState, AvrPhState, AvrCo2ValveCapture, CaptureState, AvrTimeSync, AvrCo2CurveState, Co2CurveMode, AvrCo2nnPrediction, AvrEvent, AvrTrace } from "server/service/AvrService";
 import SerialPort from "serialport";
 import logger from "server/logger";
-import { SerialportReadlineParser } from "./ReadlineParser";
-import { avrProtocolVersion, asAvrData, AvrData } from "server/avr/protocol";
-import { Subject } from "rxjs";
-import { recurrent } from "../misc/recurrent";
-import ConfigService from "server/service/ConfigService";
+import { avrProtocolVersion, AvrData, AvrCommandCode, AvrStatusFormat, decodeAvrStatusFrame } from "server/avr/protocol";
+import { Subject, Observable, SchedulerLike, timer } from "rxjs";
+import ConfigService, { PhSensorCalibrationConfig, ScheduleConfig, ScheduleTransitionConfig, PhControllerConfig } from "server/service/ConfigService";
+import { calcMinPhEquationParams } from "server/service_impl/Co2ControllerServiceImpl";
+import { TimeSyncEstimator, TimeSyncRequest, calcTimeSyncSample, asLocalSecondsSinceMidnight, asAvrSeconds } from "server/avr/TimeSync";
+import { AvrRecorder, AVR_REPLAY_IOC_TOKEN } from "server/avr/AvrRecording";
+import { AvrLineParser, addAvrCrc } from "server/avr/AvrLineParser";
+import { decodeAvrTraceLine } from "server/avr/AvrTrace";
 
 // We do attempt to reopen the port every this number of milliseconds.
 const AUTO_REOPEN_MILLIS = 1000;
@@ -14,104 +17,350 @@ const AUTO_REOPEN_MILLIS = 1000;
 // How often we update state to AVR
 const AUTO_WRITE_MILLIS = 100;
 
-// How often we send our clock time to AVR
-const CLOCK_UPDATE_MILLIS = 3000;
+// How often we send our clock time to AVR (AVR learns crystal error, so it doesn't have to be often)
+const CLOCK_UPDATE_MILLIS = 10000;
+
+// How often we measure offset and round-trip time of AVR time (see TimeSync)
+const TIME_SYNC_MILLIS = 2000;
+
+// Phase of AVR deciseconds is adjusted only if we have at least this number of time sync samples
+const TIME_SYNC_MIN_SAMPLES_FOR_PHASE_ADJUSTMENT = 4;
+
+// How often we check that AVR uses PH calibration from our config (and upload it if not)
+const PH_CALIBRATION_CHECK_MILLIS = 10000;
+
+// AVR locks CO2 out below this PH unless PH calibration config says otherwise (see PhSensorCalibrationConfig)
+const PH_SAFETY_DEFAULT_MIN_PH = 6.6;
+const PH_SAFETY_DEFAULT_HYSTERESIS_PH = 0.1;
+
+// How often we check that AVR uses schedule from our config (and upload it if not)
+const SCHEDULE_CHECK_MILLIS = 10000;
+
+// How often we check that AVR uses CO2 curve from our config (and upload it if not)
+const CO2_CURVE_CHECK_MILLIS = 10000;
+
+// How often we check that AVR uses CO2 NN config from our config (and upload it if not)
+const CO2NN_CONFIG_CHECK_MILLIS = 10000;
+
+// We ask for events again if AVR doesn't reply within this number of milliseconds
+const EVENTS_REQUEST_TIMEOUT_MILLIS = 1000;
+
+// Must be in harmony with AK_EVENTS_SIZE in the firmware!
+const AVR_EVENTS_SIZE = 64;
+
+// Must be in harmony with AK_SCHEDULE_* in the firmware!
+const SCHEDULE_PROFILES = 4;
+const SCHEDULE_MAX_TRANSITIONS = 8;
+
+// How often we check that capture of PH samples around CO2 valve switching is armed (and arm it if not)
+const CAPTURE_ARM_CHECK_MILLIS = 10000;
+
+// AVR sends text status after reset, we switch it to binary one (see 'S' in protocol.json)
+const STATUS_FORMAT_CHECK_MILLIS = 10000;
+
+// Must be in harmony with AK_CAPTURE_* in the firmware!
+// Decimated samples are produced at 16Mhz / 128 (ADC prescaler) / 13 (cycles per conversion) / 256 (oversampling).
+const CAPTURE_SAMPLES = 512;
+const CAPTURE_PRE_TRIGGER_SAMPLES = 128;
+const CAPTURE_INVALID_SAMPLE = 0xFFFF;
+const CAPTURE_SAMPLE_PERIOD_SECONDS = 128 * 13 * 256 / 16_000_000;
+
+// AVR reports decimated ADC samples, 14 bits each (10 bits ADC + 4 bits oversampling).
+// Must be in harmony with AK_PH_OVERSAMPLING_BITS in the firmware!
+const PH_ADC_DECIMATED_RANGE = 1024 * 16;
+
+// Must be the same enum as the enum in firmware with the same name
+export enum UploadTarget {
+    PhCalibrationUpload = 1,
+    ScheduleProfileUpload = 2,
+    Co2CurveUpload = 3,
+    Co2nnConfigUpload = 4
+};
+
+// Must be the same enum as the enum in firmware with the same name
+enum ScheduleOutput {
+    ScheduleDayLight = 1,
+    ScheduleNightLight = 2,
+    ScheduleCo2 = 4
+};
+
+interface PendingCapture {
+    readonly id: number;
+    readonly co2ValveOpen: boolean;
+    readonly clockSecondsSinceMidnight: number;
+    readonly samples: (number | undefined)[];
+    received: number;
+}
+
+interface Upload {
+    readonly target: UploadTarget;
+
+    // Payload followed by CRC
+    readonly bytes: number[];
+}
 
 // ==========================================================================================
 
-function asAvrState(avrData: AvrData): AvrState {
+function asAvrState(d: AvrData, batchAgeSeconds: number): AvrState {
     const aquariumTemperatureSensor: AvrTemperatureSensorState = {
-        updateId: avrData["u8 ds18b20_aqua.get_update_id()"],
-        crcErrors: avrData["u8 ds18b20_aqua.get_crc_errors()"],
-        disconnects: avrData["u8 ds18b20_aqua.get_disconnects()"],
-        temperature: avrData["u16 ds18b20_aqua.get_temperatureX16()"] / 16.0,
-        updatedSecondsAgo: avrData["u8 ds18b20_aqua.get_updated_deciseconds_ago()"] / 10.0,
+        updateId: d.aquaTemperatureUpdateId,
+        crcErrors: d.aquaTemperatureCrcErrors,
+        disconnects: d.aquaTemperatureDisconnects,
+        temperature: d.aquaTemperature,
+        updatedSecondsAgo: d.aquaTemperatureUpdatedSecondsAgo,
     };
 
     const caseTemperatureSensor: AvrTemperatureSensorState = {
-        updateId: avrData["u8 ds18b20_case.get_update_id()"],
-        crcErrors: avrData["u8 ds18b20_case.get_crc_errors()"],
-        disconnects: avrData["u8 ds18b20_case.get_disconnects()"],
-        temperature: avrData["u16 ds18b20_case.get_temperatureX16()"] / 16.0,
-        updatedSecondsAgo: avrData["u8 ds18b20_case.get_updated_deciseconds_ago()"] / 10.0,
+        updateId: d.caseTemperatureUpdateId,
+        crcErrors: d.caseTemperatureCrcErrors,
+        disconnects: d.caseTemperatureDisconnects,
+        temperature: d.caseTemperature,
+        updatedSecondsAgo: d.caseTemperatureUpdatedSecondsAgo,
     };
 
     const ph: AvrPhState = {
-        voltage: avrData["u32 __ph_adc_accum"] / (avrData["u16 __ph_adc_accum_samples"] || 1) * 5.0 / 1024.0,
-        voltageSamples: avrData["u16 __ph_adc_accum_samples"],
-        badSamples: avrData["u16 __ph_adc_bad_samples"]
+        batchTick: d.phBatchTick,
+        batchAgeSeconds,
+        batchOverflows: d.phBatchOverflows,
+        voltage: d.phBatchAccum / (d.phBatchSamples || 1) * 5.0 / PH_ADC_DECIMATED_RANGE,
+        voltageSamples: d.phBatchSamples,
+        badSamples: d.phBatchBadSamples,
+        value: d.ph || null,
+        value60s: d.ph60s || null,
+        value60sSeconds: d.ph60sSeconds,
+        value600s: d.ph600s || null,
+        value600sSeconds: d.ph600sSeconds,
+        compensationTemperature: d.phCompensationTemperature,
+        calibrationCrc: d.phCalibrationValid ? d.phCalibrationCrc : null,
+        safetyCo2Lockout: !!d.phSafetyCo2Lockout
     };
 
-    const light: AvrLightState = {
-        dayLightOn: !!avrData["u8 day_light_switch.is_set() ? 1 : 0"],
-        nightLightOn: !!avrData["u8 night_light_switch.is_set() ? 1 : 0"],
-        dayLightForced: !!avrData["u8 day_light_forced.is_set() ? 1 : 0"],
-        nightLightForced: !!avrData["u8 night_light_forced.is_set() ? 1 : 0"],
-        lightForcesSinceProtectionStatReset: avrData["u8 light_forces_since_protection_stat_reset"],
-        alternativeDayEnabled: !!avrData["u8 alternative_day_enabled"],
+    const co2Curve: AvrCo2CurveState = {
+        mode: d.co2CurveMode,
+        crc: d.co2CurveCrc,
+        inControl: !!d.co2CurveInControl,
+        co2IsRequired: !!d.co2CurveRequiredState,
+        minPh: d.co2CurveMinPh || null
     };
 
-    let clockDriftSeconds = avrData["u32 ((u32)last_drift_of_clock_deciseconds_since_midnight)"];
-    if (clockDriftSeconds > 0x7FFFFFFF) {
-        clockDriftSeconds = clockDriftSeconds - 0x100000000;
-    }
-    clockDriftSeconds = clockDriftSeconds / 10.0;
+    const co2nnPrediction: AvrCo2nnPrediction | null = d.co2nnPredictionId ? {
+        id: d.co2nnPredictionId,
+        minPh: d.co2nnPredictionMinPh,
+        onClose: !!d.co2nnPredictionOnClose,
+        cycles: d.co2nnPredictionCycles
+    } : null;
+
+    const light: AvrLightState = {
+        dayLightOn: !!d.dayLightOn,
+        nightLightOn: !!d.nightLightOn,
+        dayLightForced: !!d.dayLightForced,
+        nightLightForced: !!d.nightLightForced,
+        lightForcesSinceProtectionStatReset: d.lightForcesSinceProtectionStatReset,
+        alternativeDayEnabled: d.scheduleProfile === 1,
+        scheduleProfile: d.scheduleProfile,
+        scheduleCrc: d.scheduleCrc,
+        dayLightLevel: d.dayLightLevel,
+        nightLightLevel: d.nightLightLevel,
+    };
 
     return {
-        uptimeSeconds: avrData["u32 uptime_deciseconds"] / 10.0,
-        clockDriftSeconds,
-        clockCorrectionsSinceProtectionStatReset: avrData["u32 clock_corrections_since_protection_stat_reset"],
-        clockSecondsSinceMidnight: avrData["u32 clock_deciseconds_since_midnight"] / 10.0,
-        mainLoopIterationsInLastDecisecond: avrData["u32 main_loop_iterations_in_last_decisecond"],
-        debugOverflows: avrData["u8 debug_overflow_count"],
-        usbRxOverflows: avrData["u8 usart0_rx_overflow_count"],
-        co2ValveOpen: !!avrData["u8 co2_switch.is_set() ? 1 : 0"],
-        co2CooldownSeconds: avrData["u32 co2_deciseconds_until_can_turn_on"] / 10,
-        co2IsRequired: !!avrData["u8 required_co2_switch_state.is_set() ? 1 : 0"],
-        co2day: !!avrData["u8 co2_calculated_day ? 1 : 0"],
-        co2forcedOff: !!avrData["u8 co2_force_off.is_set() ? 1 : 0"],
+        uptimeSeconds: d.uptimeSeconds,
+        clockDriftSeconds: d.clockDriftSeconds,
+        clockCorrectionsSinceProtectionStatReset: d.clockCorrectionsSinceProtectionStatReset,
+        clockTrimPpm: d.clockTrimPpm,
+        clockSecondsSinceMidnight: d.clockSecondsSinceMidnight,
+        mainLoopIterationsInLastDecisecond: d.mainLoopIterationsInLastDecisecond,
+        traceDrops: d.traceDrops,
+        usbRxOverflows: d.usbRxOverflows,
+        uploadErrors: d.uploadErrors,
+        resetFlags: d.resetFlags,
+        warmRestarted: !!d.warmRestarted,
+        eventsNextSeq: d.eventsNextSeq,
+        co2ValveOpen: !!d.co2ValveOpen,
+        co2CooldownSeconds: d.co2CooldownSeconds,
+        co2IsRequired: !!d.co2IsRequired,
+        co2day: !!d.co2Day,
+        co2forcedOff: !!d.co2ForcedOff,
+        captureState: d.captureState,
+        captureId: d.captureId,
+        captureCo2ValveOpen: !!d.captureCo2ValveOpen,
+        captureClockSecondsSinceMidnight: d.captureClockSecondsSinceMidnight,
         aquariumTemperatureSensor,
         caseTemperatureSensor,
         light,
-        ph
+        ph,
+        co2Curve,
+        co2nnPrediction,
+        co2nnConfigCrc: d.co2nnConfigValid ? d.co2nnConfigCrc : null
     };
 }
 
 // ==========================================================================================
 
-function addCrc(crc: number, byte: number): number {
-    for (let j = 0; j < 8; j++) {
-        let m = (crc ^ byte) & 1;
-        crc >>= 1;
-        if (m) {
-            crc ^= 0x8C;
-        }
-        byte >>= 1;
+function calcCrc(str: string): number {
+    let crc = 0;
+    for (let i = 0; i < str.length; i++) {
+        crc = addAvrCrc(crc, str.charCodeAt(i));
     }
-
     return crc;
 }
 
-function calcCrc(str: string): number {
+function parseHex(str: string): number {
+    return parseInt("0x" + (str || "0"));
+}
+
+function calcBytesCrc(bytes: ArrayLike<number>): number {
     let crc = 0;
-    for (let i = 0; i < str.length; i++) {
-        crc = addCrc(crc, str.charCodeAt(i));
+    for (let i = 0; i < bytes.length; i++) {
+        crc = addAvrCrc(crc, bytes[i]);
     }
     return crc;
 }
 
+// AVR clock runs in local time and it's close to ours, so we take the last such time
+function asUnixTimeFromClock(clockSecondsSinceMidnight: number, nowMillis: number): number {
+    const now = new Date(nowMillis);
+    const midnight = new Date(now.getFullYear(), now.getMonth(), now.getDate());
+    const t = midnight.getTime() / 1000 + clockSecondsSinceMidnight;
+    return Math.round(t > now.getTime() / 1000 ? t - 24 * 60 * 60 : t);
+}
+
+function asCo2ValveCapture(c: PendingCapture, nowMillis: number): AvrCo2ValveCapture {
+    return {
+        switchTime: asUnixTimeFromClock(c.clockSecondsSinceMidnight, nowMillis),
+        co2ValveOpen: c.co2ValveOpen,
+        samplePeriodSeconds: CAPTURE_SAMPLE_PERIOD_SECONDS,
+        preTriggerSamples: CAPTURE_PRE_TRIGGER_SAMPLES,
+        voltages: c.samples.map(s => (s === undefined || s === CAPTURE_INVALID_SAMPLE) ? null : s * 5.0 / PH_ADC_DECIMATED_RANGE)
+    };
+}
+
+// ==========================================================================================
+
+function createUpload(target: UploadTarget, payload: number[]): Upload {
+    return { target, bytes: [...payload, calcBytesCrc(payload)] };
+}
+
+function asU16Bytes(v: number): number[] {
+    return [v & 0xFF, (v >> 8) & 0xFF];
+}
+
+// See PhCalibration struct in the firmware.
+// Returns undefined for calibration AVR would reject (two points must differ both in PH and in ADC value,
+// safety limit plus hysteresis must be a PH).
+function createPhCalibrationUpload(c: PhSensorCalibrationConfig): Upload | undefined {
+    const asAdc = (v: number): number => Math.round(v / 5.0 * PH_ADC_DECIMATED_RANGE);
+    const ph1Milli = Math.round(c.ph1 * 1000);
+    const ph2Milli = Math.round(c.ph2 * 1000);
+    const safetyMinMilliPh = Math.round((c.safetyMinPh ?? PH_SAFETY_DEFAULT_MIN_PH) * 1000);
+    const safetyHysteresisMilliPh = Math.round((c.safetyHysteresisPh ?? PH_SAFETY_DEFAULT_HYSTERESIS_PH) * 1000);
+
+    if (ph1Milli === ph2Milli || asAdc(c.v1) === asAdc(c.v2)
+        || safetyMinMilliPh < 0 || safetyHysteresisMilliPh < 0 || safetyMinMilliPh + safetyHysteresisMilliPh > 14000) {
+        logger.error("AVR: PH calibration is invalid, it won't be uploaded", { calibration: c });
+        return undefined;
+    }
+
+    return createUpload(UploadTarget.PhCalibrationUpload, [
+        ...asU16Bytes(ph1Milli),
+        ...asU16Bytes(asAdc(c.v1)),
+        ...asU16Bytes(ph2Milli),
+        ...asU16Bytes(asAdc(c.v2)),
+        ...asU16Bytes(Math.round(c.temperature * 16)),
+        ...asU16Bytes(safetyMinMilliPh),
+        ...asU16Bytes(safetyHysteresisMilliPh)
+    ]);
+}
+
+// See ScheduleProfile struct in the firmware
+function asScheduleProfileBytes(transitions: ReadonlyArray<ScheduleTransitionConfig>): number[] {
+    if (!transitions.length || transitions.length > SCHEDULE_MAX_TRANSITIONS) {
+        throw new Error("Schedule profile must have 1.." + SCHEDULE_MAX_TRANSITIONS + " transitions");
+    }
+
+    const bytes = [transitions.length];
+
+    for (let i = 0; i < SCHEDULE_MAX_TRANSITIONS; i++) {
+        const t = transitions[i];
+
+        if (t) {
+            const outputs = (t.dayLight ? ScheduleOutput.ScheduleDayLight : 0)
+                | (t.nightLight ? ScheduleOutput.ScheduleNightLight : 0)
+                | (t.co2 ? ScheduleOutput.ScheduleCo2 : 0);
+
+            bytes.push(...asU16Bytes(t.minute), outputs);
+        } else {
+            // Unused transitions must be zero
+            bytes.push(0, 0, 0);
+        }
+    }
+
+    return bytes;
+}
+
+// Profiles that are not configured are the same as the normal day (like defaults in firmware)
+function createScheduleProfileUploads(c: ScheduleConfig): { uploads: Upload[], crc: number } {
+    const profiles = Array.from({ length: SCHEDULE_PROFILES }, (_, i) => asScheduleProfileBytes(c.profiles[i] ?? c.profiles[0]));
+
+    return {
+        uploads: profiles.map((bytes, i) => createUpload(UploadTarget.ScheduleProfileUpload, [i, ...bytes])),
+        crc: calcBytesCrc(([] as number[]).concat(...profiles))
+    };
+}
+
+const co2CurveModes: { [mode in PhControllerConfig["avrCo2Controller"]]: Co2CurveMode } = {
+    disabled: Co2CurveMode.Co2CurveDisabled,
+    fallback: Co2CurveMode.Co2CurveFallback,
+    continuous: Co2CurveMode.Co2CurveContinuous
+};
+
+function asFloatBytes(v: number): number[] {
+    const view = new DataView(new ArrayBuffer(4));
+    view.setFloat32(0, v, true);
+    return [view.getUint8(0), view.getUint8(1), view.getUint8(2), view.getUint8(3)];
+}
+
+// See Co2Curve struct in the firmware, it's the same curve Co2ControllerServiceImpl uses
+function createCo2CurveUpload(c: PhControllerConfig, altDay: boolean): Upload {
+    const { a, b, c: c2, d } = calcMinPhEquationParams({ phControllerConfig: c, altDay });
+    const asMinute = (hour: number): number => Math.round(hour * 60);
+
+    return createUpload(UploadTarget.Co2CurveUpload, [
+        co2CurveModes[c.avrCo2Controller],
+        ...asFloatBytes(a),
+        ...asFloatBytes(b),
+        ...asFloatBytes(c2),
+        ...asFloatBytes(d),
+        ...asU16Bytes(asMinute(altDay ? c.altDayPrepareHour : c.normDayPrepareHour)),
+        ...asU16Bytes(asMinute(altDay ? c.altDayStartHour : c.normDayStartHour)),
+        ...asU16Bytes(asMinute(altDay ? c.altDayEndHour : c.normDayEndHour)),
+        ...asU16Bytes(Math.round(c.phTurnOnOffMargin * 1000))
+    ]);
+}
+
+// See Co2nnConfig struct in the firmware, it's the instance feature PhPredictionWorkerThread uses
+function createCo2nnConfigUpload(instanceId: number): Upload {
+    return createUpload(UploadTarget.Co2nnConfigUpload, [instanceId === 1 ? 1 : 0]);
+}
+
 // ==========================================================================================
 
 function serializeCommands(commands: {
+    timeSyncSeq?: number,
+    eventsSeq?: number,
+    phaseAdjustment?: number,
     lightForceMode?: LightForceMode,
     newCo2ValveOpenState?: Co2ValveOpenState,
     co2ForceOff?: boolean,
-    sendClock: boolean,
-    altDayEnabled: boolean
+    getClock?: (bytesBeforeClock: number) => number,
+    scheduleProfile?: number,
+    armCapture: boolean,
+    statusFormat?: AvrStatusFormat,
+    upload?: Upload
 }): string {
     var result = "";
 
-    function addValue(id: 'L' | 'A' | 'B' | 'C' | 'D' | 'G' | 'F', v?: number): void {
+    function addValue(id: AvrCommandCode, v?: number): void {
         if (typeof v === "undefined") {
             return;
         }
@@ -126,20 +375,34 @@ function serializeCommands(commands: {
         result += ">";
     }
 
+    // Time sync request goes first, so that it's stamped as soon as possible after it's written
+    addValue('T', commands.timeSyncSeq);
+
+    // Signed, AVR expects it as a byte
+    addValue('P', typeof commands.phaseAdjustment === "undefined" ? undefined : commands.phaseAdjustment & 0xFF);
+
     addValue('L', commands.lightForceMode);
     addValue('G', commands.newCo2ValveOpenState);
     addValue('F', commands.co2ForceOff === true ? 1 : undefined);
-    addValue('D', commands.altDayEnabled ? 1 : undefined);
+    addValue('D', commands.scheduleProfile);
+    addValue('R', commands.armCapture ? 1 : undefined);
+    addValue('E', commands.eventsSeq);
+    addValue('S', commands.statusFormat);
 
-    if (commands.sendClock) {
-        // Order of commands is important!
-        const d = new Date();
-        const c = ((d.getHours() * 60 + d.getMinutes()) * 60 + d.getSeconds()) * 10 + Math.floor(d.getMilliseconds() / 100.0);
+    if (commands.getClock) {
+        // Order of commands is important! Clock is applied once 'C' is received (up to 21 bytes later).
+        const c = commands.getClock(result.length + 21);
         addValue('A', c % 256);
         addValue('B', Math.floor(c / 256) % 256);
         addValue('C', Math.floor(c / 65536));
     }
 
+    if (commands.upload) {
+        // Bytes first, then commit
+        commands.upload.bytes.forEach(b => addValue('U', b));
+        addValue('V', commands.upload.target);
+    }
+
     return result;
 }
 
@@ -158,65 +421,221 @@ const serialPortOptions: SerialPort.OpenOptions = {
 @injectable()
 export default class AvrServiceImpl extends AvrService {
     readonly avrState$ = new Subject<AvrState>();
+    readonly co2ValveCapture$ = new Subject<AvrCo2ValveCapture>();
+    readonly timeSync$ = new Subject<AvrTimeSync>();
+    readonly avrEvent$ = new Subject<AvrEvent>();
+    readonly avrTrace$ = new Subject<AvrTrace>();
 
-    private _serialPort = new SerialPort(this._configService.config.avr.port, serialPortOptions);
+    // There is no serial port if we replay a recording
+    private readonly _serialPort?: SerialPort = this._replay$ ? undefined : new SerialPort(this._configService.config.avr.port, serialPortOptions);
     private _serialPortErrorCount = 0;
     private _serialPortOpenAttemptCount = 0;
     private _outgoingMessages = 0;
     private _incomingMessages = 0;
     private _protocolCrcErrors = 0;
-    private _protocolDebugMessages = 0;
+    private _protocolTraceRecords = 0;
     private _protocolVersionMismatch: 0 | 1 = 0;
     private _lastAvrState?: AvrState;
+    private _lastStatusWasText = false;
+    private _statusFormat?: AvrStatusFormat;
     private _canWrite = false;
     private _lightForceMode?: LightForceMode;
     private _sendClockReq: boolean = false;
     private _newCo2RequiredValveOpenState?: Co2ValveOpenState;
     private _forceCo2Off?: boolean;
+    private _uploads: Upload[] = [];
+    private _armCapture: boolean = false;
+    private _pendingCapture?: PendingCapture;
+    private _sendTimeSyncReq: boolean = false;
+    private _timeSyncSeq = 0;
+    private _pendingTimeSyncRequest?: TimeSyncRequest;
+    private _phaseAdjustment?: number;
+    private readonly _timeSync = new TimeSyncEstimator();
+    // Sequence number of the next event we want from AVR (undefined until we get the first one)
+    private _eventsCursor?: number;
+    private _eventsRequestedMillis?: number;
+    private readonly _phCalibrationUpload = createPhCalibrationUpload(this._configService.config.phSensorCalibration);
+    private readonly _scheduleUploads = createScheduleProfileUploads(this._configService.config.schedule);
+    private readonly _co2CurveUpload = createCo2CurveUpload(
+        this._configService.config.phController, this._configService.config.aquaEnv.alternativeDay);
+    private readonly _co2nnConfigUpload = createCo2nnConfigUpload(this._configService.config.instanceId);
 
-    constructor(private readonly _configService: ConfigService) {
+    constructor(
+        private readonly _configService: ConfigService,
+        @optional() @inject("scheduler") private readonly _scheduler: SchedulerLike,
+        @optional() @inject(AVR_REPLAY_IOC_TOKEN) private readonly _replay$?: Observable<Buffer>
+    ) {
         super();
     }
 
     @postConstruct()
     _init(): void {
-        this._serialPort.on("error", error => this._onSerialPortError(error));
-        this._serialPort.on("open", () => this._onSerialPortOpen());
-        this._serialPort.on("close", () => this._onSerialPortClose());
+        const serialPort = this._serialPort;
 
         // Setup reaction on new data
-        const parser = this._serialPort.pipe(new SerialportReadlineParser) as NodeJS.WritableStream;
-        parser.on("data", data => this._onSerialPortData(data));
+        // Status lines are parsed right from the bytes, other lines come as strings
+        const parser = new AvrLineParser(
+            (frame, binary) => this._onStatusFrame(frame, binary),
+            line => this._onSerialPortData(line));
+
+        if (!serialPort) {
+            // Recorded bytes go through the same parser, nothing is written back
+            this._replay$?.subscribe(bytes => parser.write(bytes));
+        } else {
+            serialPort.on("error", error => this._onSerialPortError(error));
+            serialPort.on("open", () => this._onSerialPortOpen());
+            serialPort.on("close", () => this._onSerialPortClose());
+            serialPort.on("data", (bytes: Buffer) => parser.write(bytes));
 
-        // Tries to open port if closed
-        recurrent(AUTO_REOPEN_MILLIS, () => {
-            if (this._serialPort.isOpen) {
-                return;
+            // Record everything we receive (see AvrRecording)
+            const recordFile = this._configService.config.avr.recordFile;
+            if (recordFile) {
+                logger.info("AVR: Recording to " + recordFile);
+                const recorder = new AvrRecorder(recordFile);
+                serialPort.on("data", (bytes: Buffer) => recorder.add(this._nowMillis(), bytes));
             }
-            this._serialPort.open();
-            this._serialPortOpenAttemptCount += 1;
-        });
+
+            // Tries to open port if closed
+            timer(0, AUTO_REOPEN_MILLIS, this._scheduler).subscribe(() => {
+                if (serialPort.isOpen) {
+                    return;
+                }
+                serialPort.open();
+                this._serialPortOpenAttemptCount += 1;
+            });
+        }
 
         // Send commands to AVR
-        recurrent(AUTO_WRITE_MILLIS, () => this._write_commands());
+        timer(0, AUTO_WRITE_MILLIS, this._scheduler).subscribe(() => this._write_commands());
 
         // Send clock
-        recurrent(CLOCK_UPDATE_MILLIS, () => this._sendClockReq = true);
+        timer(0, CLOCK_UPDATE_MILLIS, this._scheduler).subscribe(() => this._sendClockReq = true);
+
+        // Measure AVR time
+        timer(0, TIME_SYNC_MILLIS, this._scheduler).subscribe(() => this._sendTimeSyncReq = true);
+
+        // Make sure AVR uses our PH calibration
+        timer(0, PH_CALIBRATION_CHECK_MILLIS, this._scheduler).subscribe(() => this._checkPhCalibration());
+
+        // Make sure AVR uses our schedule
+        timer(0, SCHEDULE_CHECK_MILLIS, this._scheduler).subscribe(() => this._checkSchedule());
+
+        // Make sure AVR can control CO2 by itself the same way we do
+        timer(0, CO2_CURVE_CHECK_MILLIS, this._scheduler).subscribe(() => this._checkCo2Curve());
+
+        // Make sure AVR predicts min PH for our aquarium
+        timer(0, CO2NN_CONFIG_CHECK_MILLIS, this._scheduler).subscribe(() => this._checkCo2nnConfig());
+
+        // Switch AVR back to binary status once it falls back to text one (e.g. after reset)
+        timer(0, STATUS_FORMAT_CHECK_MILLIS, this._scheduler).subscribe(() => {
+            if (this._lastStatusWasText) {
+                this._lastStatusWasText = false;
+                this._statusFormat = AvrStatusFormat.Binary;
+            }
+        });
+
+        // Keep capture armed, so we get every CO2 valve switching
+        timer(0, CAPTURE_ARM_CHECK_MILLIS, this._scheduler).subscribe(() => {
+            if (this._lastAvrState?.captureState === CaptureState.CaptureDisarmed) {
+                this._armCapture = true;
+            }
+        });
+    }
+
+    // Time of the scheduler, so replayed recordings get time of the recording
+    private _nowMillis(): number {
+        return this._scheduler ? this._scheduler.now() : Date.now();
+    }
+
+    private _checkPhCalibration(): void {
+        const ph = this._lastAvrState?.ph;
+        const upload = this._phCalibrationUpload;
+        if (!upload) {
+            return;
+        }
+
+        const crc = upload.bytes[upload.bytes.length - 1];
+
+        if (ph && ph.calibrationCrc !== crc) {
+            logger.info("AVR: Uploading PH calibration", { avrCalibrationCrc: ph.calibrationCrc, crc });
+            this._upload(upload);
+        }
+    }
+
+    private _checkSchedule(): void {
+        const light = this._lastAvrState?.light;
+        const crc = this._scheduleUploads.crc;
+
+        if (light && light.scheduleCrc !== crc) {
+            logger.info("AVR: Uploading schedule", { avrScheduleCrc: light.scheduleCrc, crc });
+            this._scheduleUploads.uploads.forEach(upload => this._upload(upload));
+        }
+    }
+
+    private _checkCo2Curve(): void {
+        const co2Curve = this._lastAvrState?.co2Curve;
+        const crc = this._co2CurveUpload.bytes[this._co2CurveUpload.bytes.length - 1];
+
+        if (co2Curve && co2Curve.crc !== crc) {
+            logger.info("AVR: Uploading CO2 curve", { avrCo2CurveCrc: co2Curve.crc, crc });
+            this._upload(this._co2CurveUpload);
+        }
+    }
+
+    private _checkCo2nnConfig(): void {
+        const avrState = this._lastAvrState;
+        const crc = this._co2nnConfigUpload.bytes[this._co2nnConfigUpload.bytes.length - 1];
+
+        if (avrState && avrState.co2nnConfigCrc !== crc) {
+            logger.info("AVR: Uploading CO2 NN config", { avrCo2nnConfigCrc: avrState.co2nnConfigCrc, crc });
+            this._upload(this._co2nnConfigUpload);
+        }
+    }
+
+    // Uploads are sent one per write
+    private _upload(upload: Upload): void {
+        if (this._uploads.indexOf(upload) < 0) {
+            this._uploads.push(upload);
+        }
+    }
+
+    // Profile is sent only if AVR uses another one
+    private _getScheduleProfileToSend(): number | undefined {
+        const light = this._lastAvrState?.light;
+        const profile = this._configService.config.aquaEnv.alternativeDay ? 1 : 0;
+
+        return (light && light.scheduleProfile !== profile) ? profile : undefined;
     }
 
     // Write commands if needed, this is called recurrently
     private _write_commands(): void {
-        if (!this._canWrite) {
+        const serialPort = this._serialPort;
+        if (!this._canWrite || !serialPort) {
             return;
         }
 
+        // Time sync and clock depend on AVR time that is going to change with phase adjustment,
+        // so they wait until the phase adjustment is sent.
+        const adjustingPhase = typeof this._phaseAdjustment !== "undefined";
+
+        // Time sync request is identified by sequence number 1..255
+        const timeSyncSeq = (this._sendTimeSyncReq && !adjustingPhase) ? (this._timeSyncSeq % 255) + 1 : undefined;
+        const sendClock = this._sendClockReq && !adjustingPhase;
+        const eventsSeq = this._getEventsSeqToRequest();
+
         // Create commands, this will return empty string if no commands needed
         const text = serializeCommands({
+            timeSyncSeq,
+            eventsSeq,
+            phaseAdjustment: this._phaseAdjustment,
             lightForceMode: this._lightForceMode,
-            sendClock: this._sendClockReq,
+            getClock: sendClock ? (bytesBeforeClock => this._getClockToSend(bytesBeforeClock)) : undefined,
             newCo2ValveOpenState: this._newCo2RequiredValveOpenState,
             co2ForceOff: this._forceCo2Off,
-            altDayEnabled: this._configService.config.aquaEnv.alternativeDay
+            scheduleProfile: this._getScheduleProfileToSend(),
+            armCapture: this._armCapture,
+            statusFormat: this._statusFormat,
+            upload: this._uploads[0]
         });
 
         // Don't try to write if there is nothing to write
@@ -228,19 +647,68 @@ export default class AvrServiceImpl extends AvrService {
         this._forceCo2Off = undefined;
         this._lightForceMode = undefined;
         this._newCo2RequiredValveOpenState = undefined;
-        this._sendClockReq = false;
+        this._sendClockReq = this._sendClockReq && !sendClock;
+        this._uploads.shift();
+        this._armCapture = false;
+        this._statusFormat = undefined;
+
+        if (typeof eventsSeq !== "undefined") {
+            this._eventsRequestedMillis = this._nowMillis();
+        }
+
+        // AVR time changes once phase is adjusted, so we have to measure it again
+        if (adjustingPhase) {
+            logger.info("AVR: Adjusting phase", { units: this._phaseAdjustment });
+            this._phaseAdjustment = undefined;
+            this._pendingTimeSyncRequest = undefined;
+            this._timeSync.reset();
+        }
+
+        if (timeSyncSeq) {
+            this._sendTimeSyncReq = false;
+
+            // Second 'T' is the one stamped by AVR: <TseqTseq>
+            this._timeSyncSeq = timeSyncSeq;
+            this._pendingTimeSyncRequest = {
+                seq: timeSyncSeq,
+                sentSeconds: this._nowMillis() / 1000,
+                stampBytes: text.indexOf('T', 2) + 1
+            };
+        }
 
         // Set us into busy mode
         this._canWrite = false;
 
         // Actually write
         logger.debug("Writing");
-        this._serialPort.write(text, undefined, () => {
+        serialPort.write(text, undefined, () => {
             this._canWrite = true;
             this._outgoingMessages += 1;
             logger.debug("Done writing");
         });
-        this._serialPort.drain();
+        serialPort.drain();
+    }
+
+    // Events are requested only if AVR has logged something we don't have yet
+    private _getEventsSeqToRequest(): number | undefined {
+        const avrState = this._lastAvrState;
+        if (!avrState || avrState.eventsNextSeq === this._eventsCursor) {
+            return undefined;
+        }
+
+        if (this._eventsRequestedMillis && this._nowMillis() - this._eventsRequestedMillis < EVENTS_REQUEST_TIMEOUT_MILLIS) {
+            return undefined;
+        }
+
+        // AVR replies with the oldest event it has if the requested one is gone
+        return this._eventsCursor ?? 0;
+    }
+
+    // Clock that is correct when AVR applies it (or just our current clock if we don't know AVR time yet)
+    private _getClockToSend(bytesBeforeClock: number): number {
+        const nowSeconds = this._nowMillis() / 1000;
+        const clock = this._timeSync.getClockToSend(nowSeconds, bytesBeforeClock);
+        return typeof clock === "undefined" ? Math.floor(asLocalSecondsSinceMidnight(nowSeconds) * 10) : clock;
     }
 
     private _onSerialPortOpen(): void {
@@ -253,72 +721,268 @@ export default class AvrServiceImpl extends AvrService {
         this._canWrite = false;
     }
 
+    // Status that AvrLineParser has checked already (sections, CRC), the frame is reused by the parser
+    private _onStatusFrame(frame: Buffer, binary: boolean): void {
+        this._incomingMessages += 1;
+
+        // Check version
+        const version = frame.readUInt16LE(0);
+        this._protocolVersionMismatch = version != avrProtocolVersion ? 1 : 0;
+        if (this._protocolVersionMismatch) {
+            logger.debug("AVR: Protocol version mismatch", { version, avrProtocolVersion })
+            return;
+        }
+
+        if (!binary) {
+            this._lastStatusWasText = true;
+        }
+
+        this._onAvrData(decodeAvrStatusFrame(frame));
+    }
+
+    // Lines AvrLineParser didn't take as status: other lines, trace records and broken status lines
     private _onSerialPortData(data: string): void {
+        const receivedSeconds = this._nowMillis() / 1000;
         this._incomingMessages += 1;
 
         data = (data || "").replace("\r", "");
 
-        if (data.indexOf('>') >= 0) {
-            logger.warn("AVR: Protocol debug: " + data);
-            this._protocolDebugMessages += 1;
+        // Status lines that AvrLineParser has rejected (size, sections or CRC don't match)
+        if (data[0] === '#' || data[0] === ' ') {
+            logger.debug("AVR: Broken status", { data });
+            this._protocolCrcErrors += 1;
+            return;
+        }
+
+        // Trace record is binary, its bytes may look like anything else
+        if (data[0] === '%') {
+            this._onTrace(data, receivedSeconds);
             return;
         }
 
+        if (data[0] === '~') {
+            this._onCaptureChunk(data);
+            return;
+        }
+
+        if (data[0] === '=') {
+            this._onTimeSyncReply(data, receivedSeconds);
+            return;
+        }
+
+        if (data[0] === '!') {
+            this._onEvents(data, receivedSeconds);
+            return;
+        }
+
+        // Doesn't look sane
+        this._protocolCrcErrors += 1;
+    }
+
+    private _onAvrData(avrData: AvrData): void {
+        logger.debug("AVR: parsed data", { avrData });
+
+        // PH batch is stamped with AVR time, we convert it like time of events
+        const receivedSeconds = this._nowMillis() / 1000;
+        const best = this._timeSync.getBest();
+        const batchAgeSeconds = best
+            ? receivedSeconds - (asAvrSeconds(avrData.phBatchTick, 0) - best.offsetSeconds)
+            : asAvrSeconds(Math.round(avrData.uptimeSeconds * 10) - avrData.phBatchTick, 0);
+
+        // Convert into AvrState and publish
+        const avrState = asAvrState(avrData, Math.max(0, batchAgeSeconds));
+        logger.debug("AVR: next AvrSate", { avrState });
+
+        // Sequence numbers of events start from zero again after AVR restarts
+        if (this._lastAvrState && avrState.uptimeSeconds < this._lastAvrState.uptimeSeconds) {
+            this._eventsCursor = undefined;
+        }
+
+        this._lastAvrState = avrState;
+        this.avrState$.next(avrState);
+
+        this._updatePendingCapture(avrState);
+    }
+
+    // Starts collecting chunks of a new capture once AVR reports it
+    private _updatePendingCapture(avrState: AvrState): void {
+        const recorded = avrState.captureState === CaptureState.CaptureTriggered || avrState.captureState === CaptureState.CaptureReady;
+
+        if (recorded && this._pendingCapture?.id !== avrState.captureId) {
+            if (this._pendingCapture) {
+                logger.warn("AVR: Incomplete capture dropped", { id: this._pendingCapture.id, received: this._pendingCapture.received });
+            }
+
+            this._pendingCapture = {
+                id: avrState.captureId,
+                co2ValveOpen: avrState.captureCo2ValveOpen,
+                clockSecondsSinceMidnight: avrState.captureClockSecondsSinceMidnight,
+                samples: Array(CAPTURE_SAMPLES).fill(undefined),
+                received: 0
+            };
+        }
+    }
+
+    // Chunk looks like: ~id,offset,sample1,...,sampleN crc
+    private _onCaptureChunk(data: string): void {
         const fields = data.split(" ");
 
-        if (fields.length < 4 || fields[0] != '') {
-            // Doesn't look sane
+        if (fields.length != 2) {
             this._protocolCrcErrors += 1;
             return;
         }
 
-        function parseHex(str: string): number {
-            return parseInt("0x" + (str || "0"));
+        const crc = parseHex(fields[1]);
+        const calculatedCrc = calcCrc(fields[0] + " ");
+
+        if (calculatedCrc != crc) {
+            logger.debug("AVR: Wrong capture chunk CRC", { crc, calculatedCrc });
+            this._protocolCrcErrors += 1;
+            return;
+        }
+
+        const [id, offset, ...samples] = fields[0].substr(1).split(",").map(parseHex);
+        const capture = this._pendingCapture;
+
+        if (!capture || capture.id !== id) {
+            return;
+        }
+
+        samples.forEach((sample, i) => {
+            if (offset + i < CAPTURE_SAMPLES && capture.samples[offset + i] === undefined) {
+                capture.samples[offset + i] = sample;
+                capture.received += 1;
+            }
+        });
+
+        if (capture.received == CAPTURE_SAMPLES) {
+            logger.info("AVR: Capture received", { id });
+            this._pendingCapture = undefined;
+            this.co2ValveCapture$.next(asCo2ValveCapture(capture, this._nowMillis()));
         }
+    }
 
-        // Check CRC
-        const crcField = fields[fields.length - 1];
-        const crc = parseHex(crcField);
-        const crcSubject = data.substr(0, data.length - crcField.length)
-        const calculatedCrc = calcCrc(crcSubject);
+    // Reply looks like: =seq,rx_periods,rx_ticks,tx_periods,tx_ticks,tx_clock crc
+    private _onTimeSyncReply(data: string, receivedSeconds: number): void {
+        const fields = data.split(" ");
+
+        if (fields.length != 2) {
+            this._protocolCrcErrors += 1;
+            return;
+        }
+
+        const crc = parseHex(fields[1]);
+        const calculatedCrc = calcCrc(fields[0] + " ");
 
         if (calculatedCrc != crc) {
-            logger.debug("AVR: Wrong CRC", { crc, calculatedCrc, crcSubject })
+            logger.debug("AVR: Wrong time sync reply CRC", { crc, calculatedCrc });
             this._protocolCrcErrors += 1;
             return;
         }
 
-        // Check version
-        const version = parseHex(fields[fields.length - 2]);
-        this._protocolVersionMismatch = version != avrProtocolVersion ? 1 : 0;
-        if (this._protocolVersionMismatch) {
-            logger.debug("AVR: Protocol version mismatch", { version, avrProtocolVersion })
+        const [seq, rxPeriods, rxTicks, txPeriods, txTicks, txClockDeciseconds] = fields[0].substr(1).split(",").map(parseHex);
+        const request = this._pendingTimeSyncRequest;
+
+        if (!request || request.seq !== seq) {
+            return;
+        }
+
+        this._pendingTimeSyncRequest = undefined;
+
+        const sample = calcTimeSyncSample(request, {
+            seq, rxPeriods, rxTicks, txPeriods, txTicks, txClockDeciseconds, receivedSeconds,
+            bytes: data.length + 2 // '\r\n'
+        });
+        logger.debug("AVR: Time sync sample", { sample });
+
+        if (!this._timeSync.add(sample)) {
+            return;
+        }
+
+        this.timeSync$.next({ rttSeconds: sample.rttSeconds, clockOffsetSeconds: sample.clockOffsetSeconds });
+
+        if (this._timeSync.getSamplesCount() >= TIME_SYNC_MIN_SAMPLES_FOR_PHASE_ADJUSTMENT) {
+            this._phaseAdjustment = this._timeSync.getPhaseAdjustment();
+        }
+    }
+
+    // Events look like: !periods,seq,tick1,code1,arg1,...,tickN,codeN,argN crc
+    private _onEvents(data: string, receivedSeconds: number): void {
+        const fields = data.split(" ");
+
+        if (fields.length != 2) {
+            this._protocolCrcErrors += 1;
+            return;
+        }
+
+        const crc = parseHex(fields[1]);
+        const calculatedCrc = calcCrc(fields[0] + " ");
+
+        if (calculatedCrc != crc) {
+            logger.debug("AVR: Wrong events CRC", { crc, calculatedCrc });
+            this._protocolCrcErrors += 1;
             return;
         }
 
-        // Parse fields
-        const vals: { [id: string]: number } = {};
-        for (let fieldIdx = 1; fieldIdx < fields.length - 2; fieldIdx++) {
-            const field = fields[fieldIdx];
-            const prefix = field[0];
-            const valStrings = field.substr(1).split(",");
-            for (let valIdx = 0; valIdx < valStrings.length; valIdx++) {
-                vals[prefix + (valIdx + 1)] = parseHex(valStrings[valIdx]);
+        const [periods, seq, ...values] = fields[0].substr(1).split(",").map(parseHex);
+        this._eventsRequestedMillis = undefined;
+
+        // The line might repeat events we already have (if we asked twice) or AVR might have overwritten some
+        let skip = 0;
+        if (typeof this._eventsCursor !== "undefined") {
+            const behind = (this._eventsCursor - seq) & 0xFF;
+            if (behind <= AVR_EVENTS_SIZE) {
+                skip = behind;
+            } else {
+                logger.warn("AVR: Events lost", { count: (seq - this._eventsCursor) & 0xFF });
             }
         }
 
-        logger.debug("AVR: parsed values", { vals });
+        // Events are stamped with AVR time, we convert it using time sync (if we have it)
+        const best = this._timeSync.getBest();
 
-        // Convert into more meaningful and stable AvrData structure
-        const avrData = asAvrData(vals);
-        logger.debug("AVR: parsed data", { avrData });
+        for (let i = skip; i * 3 + 2 < values.length; i++) {
+            const [tick, code, arg] = values.slice(i * 3, i * 3 + 3);
+            const event: AvrEvent = {
+                seq: (seq + i) & 0xFF,
+                code,
+                arg,
+                seconds: best ? asAvrSeconds(tick, 0) - best.offsetSeconds : receivedSeconds - asAvrSeconds(periods - tick, 0),
+                timeSynced: !!best
+            };
 
-        // Convert into AvrState and publish
-        const avrState = asAvrState(avrData);
-        logger.debug("AVR: next AvrSate", { avrState });
+            this._eventsCursor = (event.seq + 1) & 0xFF;
+            logger.info("AVR: Event", { event });
+            this.avrEvent$.next(event);
+        }
+    }
 
-        this._lastAvrState = avrState;
-        this.avrState$.next(avrState);
+    // Trace looks like: %periods record1 ... recordN crc (see AvrTrace)
+    private _onTrace(data: string, receivedSeconds: number): void {
+        const line = decodeAvrTraceLine(data);
+
+        if (!line) {
+            logger.debug("AVR: Broken trace line", { data });
+            this._protocolCrcErrors += 1;
+            return;
+        }
+
+        // Records are stamped with AVR time, we convert it like time of events
+        const best = this._timeSync.getBest();
+
+        line.records.forEach(({ name, periods, dropped, args }) => {
+            const trace: AvrTrace = {
+                name,
+                args,
+                dropped,
+                seconds: best ? asAvrSeconds(periods, 0) - best.offsetSeconds : receivedSeconds - asAvrSeconds(line.periods - periods, 0),
+                timeSynced: !!best
+            };
+
+            this._protocolTraceRecords += 1;
+            logger.info("AVR: Trace", { trace });
+            this.avrTrace$.next(trace);
+        });
     }
 
     private _onSerialPortError(error: Error): void {
@@ -327,7 +991,7 @@ export default class AvrServiceImpl extends AvrService {
         this._canWrite = false;
 
         // It will be automatically reopened
-        if (this._serialPort.isOpen) {
+        if (this._serialPort?.isOpen) {
             this._serialPort.close();
         }
     }
@@ -336,10 +1000,10 @@ export default class AvrServiceImpl extends AvrService {
         return {
             serialPortErrors: this._serialPortErrorCount,
             serialPortOpenAttempts: this._serialPortOpenAttemptCount,
-            serialPortIsOpen: this._serialPort.isOpen ? 1 : 0,
+            serialPortIsOpen: this._serialPort?.isOpen ? 1 : 0,
             protocolCrcErrors: this._protocolCrcErrors,
             protocolVersionMismatch: this._protocolVersionMismatch,
-            protocolDebugMessages: this._protocolDebugMessages,
+            protocolTraceRecords: this._protocolTraceRecords,
             incomingMessages: this._incomingMessages,
             outgoingMessages: this._outgoingMessages,
             lastAvrState: this._lastAvrState,
@@ -209,7 +209,7 @@ export default class Co2ControllerServiceImpl extends Co2ControllerService {
                 ph60$.pipe(startWith(undefined)),
                 co2ValveOpen$.pipe(startWith(undefined)),
                 minClosingPhPrediction$.pipe(startWith(undefined, undefined), pairwise()),
-                timer(0, SEND_REQUIREMENTS_TO_AVR_EVERY_MS)
+                timer(0, SEND_REQUIREMENTS_TO_AVR_EVERY_MS, this._scheduler)
             ]).pipe(
                 map(([ph600, ph60, co2ValveOpen, [previouslyPredictedMinPh, predictedMinPh]]) => {
                     const now = this._timeService.nowTimestamp();
@@ -351,7 +351,7 @@ export default class Co2ControllerServiceImpl extends Co2ControllerService {
     private _calcCurrentMinPh(): number | undefined {
         const altDay = this._configService.config.aquaEnv.alternativeDay;
 
-        const date = new Date();
+        const date = new Date(this._timeService.nowRoundedSeconds() * 1000.0);
         const hour = date.getHours() + date.getMinutes() / 60 + date.getSeconds() / 3600;
         const solution = altDay ? this._minPhEquationSolutionForAltDay : this._minPhEquationSolutionForNormDay;
 
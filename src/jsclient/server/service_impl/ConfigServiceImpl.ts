@@ -1,5 +1,5 @@
 import { injectable, inject } from "inversify";
-import ConfigService, { Config, ValueDisplayConfig } from "server/service/ConfigService";
+import ConfigService, { Config, ValueDisplayConfig, PhControllerConfig } from "server/service/ConfigService";
 import { Env, ENV_IOC_TOKEN } from "server/env";
 
 // ================================================================================================
@@ -34,6 +34,24 @@ export default class ConfigServiceImpl extends ConfigService {
         highRgbPcts: [100, 0, 0],
     };
 
+    private readonly _phController: PhControllerConfig = {
+        phTurnOnOffMargin: 0.1,
+        minSafePh600: 6.8,
+        minSafePh60: 6.6,
+        dayStartPh: 6.8,
+        dayEndPh: 7.2,
+
+        // Schedule uploaded to AVR is built from these parameters (see 'schedule' below)
+        normDayPrepareHour: 8,
+        normDayStartHour: 10,
+        normDayEndHour: 21,
+        altDayPrepareHour: 8,
+        altDayStartHour: 10,
+        altDayEndHour: 18,
+
+        avrCo2Controller: 'fallback',
+    };
+
     private readonly _instanceName = this._env.instanceName || "unknown";
 
     // Top-level config value
@@ -64,7 +82,8 @@ export default class ConfigServiceImpl extends ConfigService {
         },
 
         avr: {
-            port: this._env.avrPort || "/dev/ttyUSB0"
+            port: this._env.avrPort || "/dev/ttyUSB0",
+            recordFile: this._env.avrRecordFile
         },
 
         aquaTemperatureDisplay: this._aquaTemperatureDisplay,
@@ -84,7 +103,8 @@ export default class ConfigServiceImpl extends ConfigService {
                 ph1: 4.01,
                 v1: 3.109889539510251,
                 ph2: 6.86,
-                v2: 2.5899703130372185
+                v2: 2.5899703130372185,
+                temperature: 25
             },
 
             // 2020.07.28: 4.01=3.0807776310782327,   6.86=2.616606056118044
@@ -93,7 +113,8 @@ export default class ConfigServiceImpl extends ConfigService {
                 ph1: 4.01,
                 v1: 3.0509069803017206,
                 ph2: 6.86,
-                v2: 2.5927038457935496
+                v2: 2.5927038457935496,
+                temperature: 25
             },
         }),
 
@@ -117,29 +138,39 @@ export default class ConfigServiceImpl extends ConfigService {
             highRgbPcts: [100, 0, 0],
         },
 
-        phController: {
-            phTurnOnOffMargin: 0.1,
-            minSafePh600: 6.8,
-            minSafePh60: 6.6,
-            dayStartPh: 6.8,
-            dayEndPh: 7.2,
-
-            // These parameters must be in harmony with the values in the firmware!
-            normDayPrepareHour: 8,
-            normDayStartHour: 10,
-            normDayEndHour: 21,
-            altDayPrepareHour: 8,
-            altDayStartHour: 10,
-            altDayEndHour: 18,
+        phController: this._phController,
+
+        schedule: {
+            profiles: [
+                // Normal day
+                [
+                    { minute: 0, dayLight: false, nightLight: true, co2: false },
+                    { minute: this._phController.normDayPrepareHour * 60, dayLight: false, nightLight: true, co2: true },
+                    { minute: this._phController.normDayStartHour * 60, dayLight: true, nightLight: false, co2: true },
+                    { minute: this._phController.normDayEndHour * 60, dayLight: false, nightLight: true, co2: false },
+                ],
+
+                // Alternative day: no night light, nap in the middle of the day
+                [
+                    { minute: 0, dayLight: false, nightLight: false, co2: false },
+                    { minute: this._phController.altDayPrepareHour * 60, dayLight: false, nightLight: false, co2: true },
+                    { minute: this._phController.altDayStartHour * 60, dayLight: true, nightLight: false, co2: true },
+                    { minute: 14 * 60, dayLight: false, nightLight: false, co2: true },
+                    { minute: 15 * 60, dayLight: true, nightLight: false, co2: true },
+                    { minute: this._phController.altDayEndHour * 60, dayLight: false, nightLight: false, co2: false },
+                ],
+            ]
         },
 
         phClosingPrediction: {
             trainDatasetPercentage: 0.90,
+            useAvr: false,
         },
 
         database: {
             baseDirectory: this._env.isDev ? ("../../temp/db-" + this._instanceName) : "/var/akua/db",
-            phClosingStateDbFileName: "ph-closing-state.db"
+            phClosingStateDbFileName: "ph-closing-state.db",
+            co2ValveCaptureDbFileName: "co2-valve-capture.db"
         },
 
         aquaEnv: {
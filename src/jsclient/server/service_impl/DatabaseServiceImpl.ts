@@ -7,6 +7,7 @@ import logger from "server/logger";
 import * as BSON from "bson";
 import _ from "lodash";
 import ConfigService from "server/service/ConfigService";
+import { AvrCo2ValveCapture } from "server/service/AvrService";
 
 @injectable()
 export default class DatabaseServiceImpl extends DatabaseService {
@@ -23,6 +24,17 @@ export default class DatabaseServiceImpl extends DatabaseService {
             "ALTER TABLE states ADD is_validation INTEGER NOT NULL DEFAULT 1"
         );
 
+    private readonly co2ValveCaptureDbPromise =
+        this._initDb(
+            this._configService.config.database.co2ValveCaptureDbFileName,
+            `
+                CREATE TABLE IF NOT EXISTS captures (
+                    switch_time INTEGER NOT NULL PRIMARY KEY,
+                    bson BLOB NOT NULL
+                )
+            `
+        );
+
     constructor(private readonly _configService: ConfigService) {
         super();
     }
@@ -75,6 +87,19 @@ export default class DatabaseServiceImpl extends DatabaseService {
         return row.cnt;
     }
 
+    async insertCo2ValveCapture(capture: AvrCo2ValveCapture): Promise<void> {
+        const co2ValveCaptureDb = await this.co2ValveCaptureDbPromise;
+
+        return run(
+            co2ValveCaptureDb,
+            "INSERT OR REPLACE INTO captures (switch_time, bson) VALUES ($switchTime, $bson)",
+            {
+                "$switchTime": capture.switchTime,
+                "$bson": BSON.serialize(capture)
+            }
+        );
+    }
+
     private _connectToDatabase(fileName: string): Promise<sqlite3.Database> {
         const configService = this._configService;
 
@@ -271,14 +271,35 @@ const avrClockCorrectionsSinceProtectionStatResetGauge = new SimpleCounter({
     help: 'Number of times clock has been corrected since statistic was reset (every hour).'
 });
 
+const avrTimeSyncRttSummary = new Summary({
+    name: 'akua_avr_time_sync_rtt_seconds',
+    help: 'Round-trip time of time sync requests sent to AVR (without serial transmission time).',
+    maxAgeSeconds: 600,
+    ageBuckets: 5,
+    percentiles: [0.1, 0.25, 0.5, 0.75, 0.9, 0.99]
+});
+
+const avrTimeSyncClockOffsetSummary = new Summary({
+    name: 'akua_avr_time_sync_clock_offset_seconds',
+    help: 'Offset of AVR clock compared to clock of raspberry pi as measured by time sync.',
+    maxAgeSeconds: 600,
+    ageBuckets: 5,
+    percentiles: [0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99]
+});
+
+const avrClockTrimPpmGauge = new SimpleGauge({
+    name: 'akua_avr_clock_trim_ppm',
+    help: 'Crystal error learned by AVR from clock drift history (positive means that crystal is fast).'
+});
+
 const avrClockSecondsSinceMidnightGauge = new SimpleGauge({
     name: 'akua_avr_clock_seconds_since_midnight',
     help: 'Number of seconds since midnight (i.e. clock of AVR).'
 });
 
-const avrDebugOverflowsGauge = new SimpleCounter({
-    name: 'akua_avr_debug_overflows',
-    help: 'Number of times AVR was out of buffer space trying to send debug info to host.'
+const avrTraceDropsGauge = new SimpleCounter({
+    name: 'akua_avr_trace_drops',
+    help: 'Number of trace records dropped by AVR (rate limit or no buffer space), saturated at 255.'
 });
 
 const avrUsbRxOverflowsGauge = new SimpleCounter({
@@ -286,6 +307,26 @@ const avrUsbRxOverflowsGauge = new SimpleCounter({
     help: 'Number of times AVR was out of buffer trying to receive data from USB.'
 });
 
+const avrResetFlagsGauge = new SimpleGauge({
+    name: 'akua_avr_reset_flags',
+    help: 'MCUSR of AVR as it was on startup (1 - power-on, 2 - external, 4 - brown-out, 8 - watchdog reset).'
+});
+
+const avrWarmRestartedGauge = new SimpleGauge({
+    name: 'akua_avr_warm_restarted',
+    help: 'Whether AVR resumed its control state after the last reset.'
+});
+
+const avrUploadErrorsGauge = new SimpleCounter({
+    name: 'akua_avr_upload_errors',
+    help: 'Number of times AVR rejected uploaded data (wrong size or CRC).'
+});
+
+const avrPhBatchOverflowsGauge = new SimpleCounter({
+    name: 'akua_avr_ph_batch_overflows',
+    help: 'Number of batches of ph sensor ADC samples dropped by AVR because they were not sent in time.'
+});
+
 const avrSerialPortErrorCountGauge = new SimpleCounter({
     name: 'akua_avr_serial_port_errors',
     help: 'Number of AVR serial port errors.'
@@ -301,9 +342,9 @@ const avrProtocolCrcErrorCountGauge = new SimpleCounter({
     help: 'Number of CRC errors (when decoding incoming message from AVR).'
 });
 
-const avrProtocolDebugMessageCountGauge = new SimpleCounter({
-    name: 'akua_avr_protocol_debug_messages',
-    help: 'Number of messages received from AVR.'
+const avrProtocolTraceRecordCountGauge = new SimpleCounter({
+    name: 'akua_avr_protocol_trace_records',
+    help: 'Number of trace records received from AVR.'
 });
 
 const avrIncomingMessageCountGauge = new SimpleCounter({
@@ -407,9 +448,39 @@ const avrPhBadSamplesGauge = new SimpleCounter({
     help: 'Number of bad ADC values for ph sensor (outside of allowed interval).'
 });
 
+const avrPhGauge = new SimpleGauge({
+    name: 'akua_avr_ph',
+    help: 'Last temperature compensated ph as calculated by AVR.'
+});
+
+const avrPhCompensationTemperatureGauge = new SimpleGauge({
+    name: 'akua_avr_ph_compensation_temperature',
+    help: 'Temperature used by AVR to compensate ph.'
+});
+
+const avrPhSafetyCo2LockoutGauge = new SimpleGauge({
+    name: 'akua_avr_ph_safety_co2_lockout',
+    help: '1 means that AVR does not allow CO2 because ph is too low, 0 means no lockout.'
+});
+
+const avrCo2CurveInControlGauge = new SimpleGauge({
+    name: 'akua_avr_co2_curve_in_control',
+    help: '1 means that AVR controls CO2 by itself using the uploaded min-ph curve, 0 means that host controls CO2.'
+});
+
+const avrCo2CurveMinPhGauge = new SimpleGauge({
+    name: 'akua_avr_co2_curve_min_ph',
+    help: 'Min ph of the curve uploaded to AVR for the current minute.'
+});
+
+const avrCo2nnPredictionCyclesGauge = new SimpleGauge({
+    name: 'akua_avr_co2nn_prediction_cycles',
+    help: 'CPU cycles used by the last min ph prediction on AVR.'
+});
+
 const phSensorVoltageSamplesGauge = new SimpleGauge({
     name: 'akua_ph_sensor_voltage_samples',
-    help: 'Number of ADC samples used by AVR to calculate voltage.'
+    help: 'Number of decimated ADC samples used by AVR to calculate voltage.'
 });
 
 const minClosingPhPredictionGauge = new SimpleGauge({
@@ -482,6 +553,16 @@ const nightLightOnGauge = new SimpleGauge({
     help: '1 means on, 0 means off.'
 });
 
+const dayLightLevelGauge = new SimpleGauge({
+    name: 'akua_day_light_level',
+    help: 'Brightness of day light dimmer, 0..1.'
+});
+
+const nightLightLevelGauge = new SimpleGauge({
+    name: 'akua_night_light_level',
+    help: 'Brightness of night light dimmer, 0..1.'
+});
+
 const altDayEnabledGauge = new SimpleGauge({
     name: 'akua_alt_day_enabled',
     help: '1 means alternative day enabled, 0 means normal day is enabled.'
@@ -532,6 +613,7 @@ export default class MetricsServiceImpl extends MetricsService {
 
         // Update summaries
         var lastObservedUptime: number | undefined;
+        var lastObservedPhBatchTick: number | undefined;
 
         this._subs.add(
             this._avrService.avrState$.subscribe(avrState => {
@@ -541,7 +623,18 @@ export default class MetricsServiceImpl extends MetricsService {
                     lastObservedUptime = avrState.uptimeSeconds;
                 }
 
-                avrPhBadSamplesGauge.inc(avrState.ph.badSamples);
+                // The same batch of PH samples might be sent more than once
+                if (lastObservedPhBatchTick != avrState.ph.batchTick) {
+                    avrPhBadSamplesGauge.inc(avrState.ph.badSamples);
+                    lastObservedPhBatchTick = avrState.ph.batchTick;
+                }
+            })
+        );
+
+        this._subs.add(
+            this._avrService.timeSync$.subscribe(timeSync => {
+                avrTimeSyncRttSummary.observe(timeSync.rttSeconds);
+                avrTimeSyncClockOffsetSummary.observe(timeSync.clockOffsetSeconds);
             })
         );
 
@@ -612,7 +705,7 @@ export default class MetricsServiceImpl extends MetricsService {
         avrSerialPortErrorCountGauge.set(avrServiceState.serialPortErrors);
         avrSerialPortOpenAttemptCountGauge.set(avrServiceState.serialPortOpenAttempts);
         avrProtocolCrcErrorCountGauge.set(avrServiceState.protocolCrcErrors);
-        avrProtocolDebugMessageCountGauge.set(avrServiceState.protocolDebugMessages);
+        avrProtocolTraceRecordCountGauge.set(avrServiceState.protocolTraceRecords);
         avrIncomingMessageCountGauge.set(avrServiceState.incomingMessages);
         avrOutgoingMessageCountGauge.set(avrServiceState.outgoingMessages);
         avrSerialPortIsOpenGauge.set(avrServiceState.serialPortIsOpen);
@@ -621,9 +714,14 @@ export default class MetricsServiceImpl extends MetricsService {
         // AVR related stuff
         avrUptimeSecondsGauge.setOrRemove(avrServiceState.lastAvrState?.uptimeSeconds);
         avrUsbRxOverflowsGauge.setOrRemove(avrServiceState.lastAvrState?.usbRxOverflows);
-        avrDebugOverflowsGauge.setOrRemove(avrServiceState.lastAvrState?.debugOverflows);
+        avrTraceDropsGauge.setOrRemove(avrServiceState.lastAvrState?.traceDrops);
+        avrUploadErrorsGauge.setOrRemove(avrServiceState.lastAvrState?.uploadErrors);
+        avrResetFlagsGauge.setOrRemove(avrServiceState.lastAvrState?.resetFlags);
+        avrWarmRestartedGauge.setOrRemove(avrServiceState.lastAvrState?.warmRestarted);
+        avrPhBatchOverflowsGauge.setOrRemove(avrServiceState.lastAvrState?.ph.batchOverflows);
         avrClockCorrectionsSinceProtectionStatResetGauge.setOrRemove(avrServiceState.lastAvrState?.clockCorrectionsSinceProtectionStatReset);
         avrClockDriftSecondsGauge.setOrRemove(avrServiceState.lastAvrState?.clockDriftSeconds);
+        avrClockTrimPpmGauge.setOrRemove(avrServiceState.lastAvrState?.clockTrimPpm);
         avrClockSecondsSinceMidnightGauge.setOrRemove(avrServiceState.lastAvrState?.clockSecondsSinceMidnight);
 
         // Temperature sensors
@@ -650,6 +748,8 @@ export default class MetricsServiceImpl extends MetricsService {
         const light = avrServiceState.lastAvrState?.light;
         dayLightOnGauge.setOrRemove(light?.dayLightOn);
         nightLightOnGauge.setOrRemove(light?.nightLightOn);
+        dayLightLevelGauge.setOrRemove(light?.dayLightLevel);
+        nightLightLevelGauge.setOrRemove(light?.nightLightLevel);
         dayLightForcedGauge.setOrRemove(light?.dayLightForced);
         nightLightForcedGauge.setOrRemove(light?.nightLightForced);
         altDayEnabledGauge.setOrRemove(light?.alternativeDayEnabled);
@@ -667,6 +767,16 @@ export default class MetricsServiceImpl extends MetricsService {
         phSensorVoltageSamplesGauge.setOrRemove(ph?.lastSensorState?.voltageSamples);
         phBasedCo2Gauge.setOrRemove(ph?.phBasedCo2);
 
+        const avrPh = avrServiceState.lastAvrState?.ph;
+        avrPhGauge.setOrRemove(avrPh?.value);
+        avrPhCompensationTemperatureGauge.setOrRemove(avrPh?.compensationTemperature);
+        avrPhSafetyCo2LockoutGauge.setOrRemove(avrPh?.safetyCo2Lockout);
+
+        const avrCo2Curve = avrServiceState.lastAvrState?.co2Curve;
+        avrCo2CurveInControlGauge.setOrRemove(avrCo2Curve?.inControl);
+        avrCo2CurveMinPhGauge.setOrRemove(avrCo2Curve?.minPh);
+        avrCo2nnPredictionCyclesGauge.setOrRemove(avrServiceState.lastAvrState?.co2nnPrediction?.cycles);
+
         const phControlRange = this._co2ControllerService.getPhControlRange();
         phToTurnCo2OffGauge.setOrRemove(phControlRange.phToTurnOff);
         phToTurnCo2OnGauge.setOrRemove(phControlRange.phToTurnOn);
@@ -49,6 +49,7 @@ export default class PhPredictionServiceImpl extends PhPredictionService {
     private readonly _subs = new Subscriptions();
     private _worker?: Worker;
     private _lastMinPhPrediction?: number;
+    private _lastAvrPredictionId?: number;
 
     private _lastCo2ClosingStateForDatabaseSaving?: Co2ClosingState | null;
     private _minPhAfterCloseForDatabaseSaving?: number;
@@ -68,24 +69,11 @@ export default class PhPredictionServiceImpl extends PhPredictionService {
 
     @postConstruct()
     _init(): void {
-        // Create worker thread that will actually perform predictions
-        this._worker = new Worker("./dist/server/service_impl/PhPredictionWorkerThread.js", {
-            workerData: this._configService.config
-        });
-
-        // React on messages from worker thread
-        this._worker.on('message', (message: MessageFromPhPredictionWorker) => {
-            if (message.type === 'min-ph-prediction-response') {
-                const now = this._timeService.nowTimestamp();
-                this.minClosingPhPrediction$.next({
-                    predictedMinPh: message.minPhPrediction,
-                    secondsUsedOnPrediction: getElapsedSecondsSince({ now, since: message.requestTimestamp }),
-                    valveIsAlreadyClosed: false
-                });
-            } else {
-                logger.error("PhPredictService: Unknown message type", { message });
-            }
-        });
+        if (this._configService.config.phClosingPrediction.useAvr) {
+            this._initAvrPredictions();
+        } else {
+            this._initWorker();
+        }
 
         // We need temperature
         this._subs.add(
@@ -121,6 +109,15 @@ export default class PhPredictionServiceImpl extends PhPredictionService {
             })
         );
 
+        // Save step responses of the probe for modelling
+        this._subs.add(
+            this._avrService.co2ValveCapture$.subscribe(capture => {
+                this._databaseService.insertCo2ValveCapture(capture).catch(err => {
+                    logger.error("PhPredictService: Unable to save CO2 valve capture", { err });
+                });
+            })
+        );
+
         // We need CO2 valve switch state and also light state
         // We also use this one to save predictions and stuff
         // TODO: Simplify and move to some other place, tests....
@@ -189,6 +186,51 @@ export default class PhPredictionServiceImpl extends PhPredictionService {
         this._maintainDataset();
     }
 
+    // AVR predicts every 15 seconds while CO2 valve is open and once again when it's closed
+    private _initAvrPredictions(): void {
+        this._subs.add(
+            this._avrService.avrState$.subscribe(avrState => {
+                const prediction = avrState.co2nnPrediction;
+                if (!prediction || prediction.id === this._lastAvrPredictionId) {
+                    return;
+                }
+
+                this._lastAvrPredictionId = prediction.id;
+                this._lastMinPhPrediction = prediction.minPh;
+
+                // Predictions made on close are emitted by _requestPrediction
+                if (!prediction.onClose) {
+                    this.minClosingPhPrediction$.next({
+                        predictedMinPh: prediction.minPh,
+                        secondsUsedOnPrediction: 0,
+                        valveIsAlreadyClosed: false
+                    });
+                }
+            })
+        );
+    }
+
+    private _initWorker(): void {
+        // Create worker thread that will actually perform predictions
+        this._worker = new Worker("./dist/server/service_impl/PhPredictionWorkerThread.js", {
+            workerData: this._configService.config
+        });
+
+        // React on messages from worker thread
+        this._worker.on('message', (message: MessageFromPhPredictionWorker) => {
+            if (message.type === 'min-ph-prediction-response') {
+                const now = this._timeService.nowTimestamp();
+                this.minClosingPhPrediction$.next({
+                    predictedMinPh: message.minPhPrediction,
+                    secondsUsedOnPrediction: getElapsedSecondsSince({ now, since: message.requestTimestamp }),
+                    valveIsAlreadyClosed: false
+                });
+            } else {
+                logger.error("PhPredictService: Unknown message type", { message });
+            }
+        });
+    }
+
     private async _publishDatasetStats(): Promise<void> {
         const phClosingStateValidationDatasetSize = await this._databaseService.countCo2ClosingStates(Co2ClosingStateType.VALIDATION);
         const phClosingStateTrainingDatasetSize = await this._databaseService.countCo2ClosingStates(Co2ClosingStateType.TRAINING);
@@ -6,12 +6,21 @@ import { Observable, BehaviorSubject } from "rxjs";
 import { calcCo2DivKhFromPh } from "server/misc/calcCo2DivKhFromPh";
 import TimeService from "server/service/TimeService";
 import ConfigService, { PhSensorCalibrationConfig } from "server/service/ConfigService";
+import type { Timestamp } from "server/misc/Timestamp";
+import { getTimestampSecondsBefore } from "server/misc/get-timestamp-seconds-before";
 
-// How many measurements per second our AVR performs
-const PH_SAMPLE_FREQUENCY = 7;
+// How many batches of measurements per second our AVR closes (see AK_PH_BATCH_DECISECONDS)
+const PH_SAMPLE_FREQUENCY = 2;
 
 // How many adjacent measurements to skip before and after the one marked as 'bad' (with noise in it).
-const PH_BAD_VALUE_ADJ_SKIPS = 20;
+// It's 4 seconds of measurements.
+const PH_BAD_VALUE_ADJ_SKIPS = 8;
+
+// Batch of measurements with the time AVR closed it
+interface PendingAvrPhState {
+    readonly state: AvrPhState;
+    readonly t: Timestamp;
+}
 
 interface Solution {
     a: number;
@@ -34,14 +43,20 @@ function calcPhFromVoltage(solution: Solution, voltage: number): number {
     return solution.a * voltage + solution.b;
 }
 
+// AVR averages PH only if it has calibration
+function hasAvrWindows(state: AvrPhState): boolean {
+    return state.value60s !== null || state.value600s !== null;
+}
+
 // ==========================================================================================
 
 class SensorProcessor {
     private readonly _solution: Solution = findSolution(this._configService.config.phSensorCalibration);
 
     readonly values$ = new BehaviorSubject<Ph | null>(null);
-    private _pendingAvrPhStates: AvrPhState[] = [];
+    private _pendingAvrPhStates: PendingAvrPhState[] = [];
     private _numberOfStatesToSkip: number = 0;
+    private _lastBatchTick: number | null = null;
 
     private readonly _voltage60sWindow = new AveragingWindow({
         windowSpanSeconds: 60,
@@ -55,11 +70,33 @@ class SensorProcessor {
         timeService: this._timeService
     });
 
+    private readonly _ph60sWindow = new AveragingWindow({
+        windowSpanSeconds: 60,
+        sampleFrequency: PH_SAMPLE_FREQUENCY,
+        timeService: this._timeService
+    });
+
+    private readonly _ph600sWindow = new AveragingWindow({
+        windowSpanSeconds: 600,
+        sampleFrequency: PH_SAMPLE_FREQUENCY,
+        timeService: this._timeService
+    });
+
     constructor(private _timeService: TimeService, private _configService: ConfigService) { }
 
     // TODO: We also must skip next sample if the current one is a bad one!
 
     onNewAvrState(newState: AvrPhState) {
+        // AVR repeats the last batch if there is no new one yet
+        if (newState.batchTick === this._lastBatchTick) {
+            return;
+        }
+
+        this._lastBatchTick = newState.batchTick;
+
+        // Measurements are averaged by the time AVR took them, not by the time their status came
+        const t = getTimestampSecondsBefore({ now: this._timeService.nowTimestamp(), seconds: newState.batchAgeSeconds });
+
         const thisVoltageIsGood = newState.voltage < 4 && newState.voltage > 1 && !newState.badSamples;
 
         if (thisVoltageIsGood) {
@@ -71,32 +108,28 @@ class SensorProcessor {
             } else {
                 if (this._pendingAvrPhStates.length >= PH_BAD_VALUE_ADJ_SKIPS) {
                     // We must add pending PH value because we know it's not adjacent to the invalid one
-                    const pendingAvrPhState = this._pendingAvrPhStates.shift();
-
-                    if (pendingAvrPhState) {
-                        this._voltage60sWindow.add(pendingAvrPhState.voltage);
-                        this._voltage600sWindow.add(pendingAvrPhState.voltage);
-
-                        const voltage60s = this._voltage60sWindow.get();
-                        const voltage600s = this._voltage600sWindow.get();
-
-                        const phValue600s = voltage600s ? Math.round(calcPhFromVoltage(this._solution, voltage600s) * 1000) / 1000.0 : voltage600s;
-
-                        this.values$.next({
-                            voltage60s: voltage60s,
-                            voltage60sSamples: this._voltage60sWindow.getCount(),
-                            value60s: voltage60s ? Math.round(calcPhFromVoltage(this._solution, voltage60s) * 1000) / 1000.0 : voltage60s,
-                            value60sSamples: this._voltage60sWindow.getCount(),
-                            value600s: phValue600s,
-                            value600sSamples: this._voltage600sWindow.getCount(),
-                            phBasedCo2: phValue600s ? (calcCo2DivKhFromPh(phValue600s) * this._configService.config.aquaEnv.kh) : null,
-                            lastSensorState: pendingAvrPhState
-                        });
+                    const pending = this._pendingAvrPhStates.shift();
+
+                    if (pending) {
+                        const pendingAvrPhState = pending.state;
+
+                        // Prefer temperature compensated PH calculated by AVR,
+                        // use our own calibration only if AVR doesn't have one.
+                        const ph = pendingAvrPhState.value ?? calcPhFromVoltage(this._solution, pendingAvrPhState.voltage);
+
+                        this._voltage60sWindow.add(pendingAvrPhState.voltage, pending.t);
+                        this._voltage600sWindow.add(pendingAvrPhState.voltage, pending.t);
+                        this._ph60sWindow.add(ph, pending.t);
+                        this._ph600sWindow.add(ph, pending.t);
+
+                        if (!hasAvrWindows(newState)) {
+                            this._publish(pendingAvrPhState);
+                        }
                     }
                 }
 
                 // Set new avr ph state as pending, because we must know that the next state is valid one
-                this._pendingAvrPhStates.push(newState);
+                this._pendingAvrPhStates.push({ state: newState, t });
             }
         } else {
             // This case is invalid one. Thus we invalidate the previous one (instead of using it)
@@ -104,6 +137,31 @@ class SensorProcessor {
             this._pendingAvrPhStates = [];
             this._numberOfStatesToSkip = PH_BAD_VALUE_ADJ_SKIPS;
         }
+
+        // AVR averages are already filtered and survive our restarts, no need to wait for anything
+        if (hasAvrWindows(newState)) {
+            this._publish(newState);
+        }
+    }
+
+    private _publish(sensorState: AvrPhState) {
+        const avrWindows = hasAvrWindows(sensorState);
+
+        const ph60s = avrWindows ? sensorState.value60s : this._ph60sWindow.get();
+        const ph600s = avrWindows ? sensorState.value600s : this._ph600sWindow.get();
+
+        const phValue600s = ph600s ? Math.round(ph600s * 1000) / 1000.0 : ph600s;
+
+        this.values$.next({
+            voltage60s: this._voltage60sWindow.get(),
+            voltage60sSamples: this._voltage60sWindow.getCount(),
+            value60s: ph60s ? Math.round(ph60s * 1000) / 1000.0 : ph60s,
+            value60sSamples: avrWindows ? sensorState.value60sSeconds * PH_SAMPLE_FREQUENCY : this._ph60sWindow.getCount(),
+            value600s: phValue600s,
+            value600sSamples: avrWindows ? sensorState.value600sSeconds * PH_SAMPLE_FREQUENCY : this._ph600sWindow.getCount(),
+            phBasedCo2: phValue600s ? (calcCo2DivKhFromPh(phValue600s) * this._configService.config.aquaEnv.kh) : null,
+            lastSensorState: sensorState
+        });
     }
 
     get(): Ph | null {
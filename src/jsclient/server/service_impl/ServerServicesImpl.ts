@@ -28,7 +28,7 @@ import { Env, ENV_IOC_TOKEN } from "server/env";
 import ConfigServiceImpl from "./ConfigServiceImpl";
 import ConfigService from "server/service/ConfigService";
 
-type ContainerMode = 'cli-utils' | 'express-server';
+type ContainerMode = 'cli-utils' | 'avr-replay' | 'express-server';
 
 export function createNewContainer(mode: ContainerMode, env: Env): Container {
     const container = new Container();
@@ -53,6 +53,15 @@ export function createNewContainer(mode: ContainerMode, env: Env): Container {
         container.bind(ServerServices).toSelf().inSingletonScope();
     }
 
+    // Services that work with AVR data only (see cli-utils/replayavr.ts)
+    if (mode == 'avr-replay') {
+        container.bind(AvrService).to(AvrServiceImpl).inSingletonScope();
+        container.bind(TemperatureSensorService).to(TemperatureSensorServiceImpl).inSingletonScope();
+        container.bind(PhSensorService).to(PhSensorServiceImpl).inSingletonScope();
+        container.bind(PhPredictionService).to(PhPredictionServiceImpl).inSingletonScope();
+        container.bind(Co2ControllerService).to(Co2ControllerServiceImpl).inSingletonScope();
+    }
+
     return container;
 }
 